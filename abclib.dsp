@@ -1223,6 +1223,10 @@ SOURCE=.\src\bdd\extrab\extraBddMisc.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\bdd\extrab\extraBddPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\bdd\extrab\extraBddSet.c
 # End Source File
 # Begin Source File
@@ -1991,6 +1995,10 @@ SOURCE=.\src\sat\cnf\cnfFast.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\cnf\cnfInc.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\cnf\cnfMan.c
 # End Source File
 # Begin Source File
@@ -3539,6 +3547,10 @@ SOURCE=.\src\map\if\ifDec75.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\if\ifDecCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\if\ifDelay.c
 # End Source File
 # Begin Source File
@@ -3547,6 +3559,10 @@ SOURCE=.\src\map\if\ifDsd.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\if\ifInc.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\if\ifLibBox.c
 # End Source File
 # Begin Source File
@@ -3567,6 +3583,10 @@ SOURCE=.\src\map\if\ifMatch2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\if\ifPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\if\ifReduce.c
 # End Source File
 # Begin Source File
@@ -5915,6 +5935,10 @@ SOURCE=.\src\proof\int\intFrames.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\int\intIncr.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\int\intInt.h
 # End Source File
 # Begin Source File
@@ -6007,10 +6031,18 @@ SOURCE=.\src\proof\pdr\pdrInv.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrLem.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
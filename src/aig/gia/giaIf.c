@@ -69,6 +69,7 @@ void Gia_ManSetIfParsDefault( void * pp )
     p->nCutsMax    =  8;
     p->nFlowIters  =  1;
     p->nAreaIters  =  2;
+    p->nThreads    =  1;
     p->DelayTarget = -1;
     p->Epsilon     =  (float)0.005;
     p->fPreprocess =  1;
@@ -2481,6 +2482,12 @@ Gia_Man_t * Gia_ManPerformMappingInt( Gia_Man_t * p, If_Par_t * pPars )
         if ( pPars->fDsdBalance )
             If_DsdManAllocIsops( pIfMan->pIfDsdMan, pPars->nLutSize );
     }
+    // attach the cache of decomposability verdicts
+    if ( pPars->pFuncCell && !pPars->fUseDsd )
+        If_DecCacheAttach( pIfMan, (If_DecCache_t *)Abc_FrameReadManIfDec() );
+    // reuse the mapping of the nodes that did not change since the previous run
+    if ( pPars->fIncremental && !p->pManTime && !p->vCoAttrs )
+        If_ManIncAttach( pIfMan, (If_IncMan_t *)Abc_FrameReadManIfInc() );
     // compute switching for the IF objects
     if ( pPars->fPower )
     {
@@ -2505,6 +2512,8 @@ Gia_Man_t * Gia_ManPerformMappingInt( Gia_Man_t * p, If_Par_t * pPars )
         If_ManStop( pIfMan );
         return NULL;
     }
+    if ( pPars->fIncremental )
+        Abc_FrameSetManIfInc( If_ManIncDerive(pIfMan) );
     if ( pPars->pFuncWrite )
         pPars->pFuncWrite( pIfMan );
     // transform the result of mapping into the new network
@@ -78,6 +78,8 @@ struct Mf_Man_t_
     int             fUseEla;        // use exact area
     // statistics
     abctime         clkStart;       // starting time
+    abctime         clkTruth;       // truth table computation time (sampled)
+    int             nTruthComps;    // the number of truth table computations (every 16th is timed)
     double          CutCount[4];    // cut counts
     int             nCutCounts[MF_LEAF_MAX+1];
 };
@@ -553,8 +555,9 @@ static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t
     t1 = Abc_Tt6Expand( t1, pCut1->pLeaves, pCut1->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
     t =  fIsXor ? t0 ^ t1 : t0 & t1;
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
-    if ( !p->pPars->fCnfObjIds )
-    pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
+    // the support cannot shrink if the fanin cuts are disjoint and non-constant
+    if ( !p->pPars->fCnfObjIds && (pCut0->nLeaves + pCut1->nLeaves > pCutR->nLeaves || pCut0->nLeaves == 0 || pCut1->nLeaves == 0) )
+        pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
     truthId        = Vec_MemHashInsert(p->vTtMem, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
@@ -584,7 +587,8 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
         Abc_TtXor( uTruth, uTruth0, uTruth1, nWords, (fCompl = (int)((uTruth0[0] ^ uTruth1[0]) & 1)) );
     else
         Abc_TtAnd( uTruth, uTruth0, uTruth1, nWords, (fCompl = (int)((uTruth0[0] & uTruth1[0]) & 1)) );
-    pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
+    if ( pCut0->nLeaves + pCut1->nLeaves > pCutR->nLeaves || pCut0->nLeaves == 0 || pCut1->nLeaves == 0 )
+        pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
     truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
@@ -1074,8 +1078,15 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
             if ( Mf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
             p->CutCount[2]++;
-            if ( p->pPars->fCutMin && Mf_CutComputeTruthMux(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
-                pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+            if ( p->pPars->fCutMin )
+            {
+                int fSample = p->pPars->fVerbose && (++p->nTruthComps & 15) == 0;
+                abctime clk = fSample ? Abc_Clock() : 0;
+                if ( Mf_CutComputeTruthMux(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
+                    pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+                if ( fSample )
+                    p->clkTruth += Abc_Clock() - clk;
+            }
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
             nCutsR = Mf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
@@ -1095,8 +1106,15 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
             if ( Mf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
             p->CutCount[2]++;
-            if ( p->pPars->fCutMin && Mf_CutComputeTruth(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
-                pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+            if ( p->pPars->fCutMin )
+            {
+                int fSample = p->pPars->fVerbose && (++p->nTruthComps & 15) == 0;
+                abctime clk = fSample ? Abc_Clock() : 0;
+                if ( Mf_CutComputeTruth(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
+                    pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+                if ( fSample )
+                    p->clkTruth += Abc_Clock() - clk;
+            }
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
             nCutsR = Mf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
@@ -1524,6 +1542,8 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
             printf( "%d = %d  ", i, p->nCutCounts[i] );
         if ( p->vTtMem )
             printf( "TT = %d (%.2f %%)  ", Vec_MemEntryNum(p->vTtMem), 100.0 * Vec_MemEntryNum(p->vTtMem) / p->CutCount[2] );
+        if ( p->clkTruth )
+            printf( "Truth = %.2f Mcuts/sec  ", 1.0e-6 * (p->nTruthComps / 16) * CLOCKS_PER_SEC / p->clkTruth );
         Abc_PrintTime( 1, "Time",    Abc_Clock() - p->clkStart );
     }
     fflush( stdout );
@@ -37,6 +37,24 @@
 #  define __builtin_popcount __popcnt
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -48,6 +66,8 @@ ABC_NAMESPACE_IMPL_START
 #define NF_NO_LEAF  31
 #define NF_NO_FUNC  0x3FFFFFF
 #define NF_EPSILON  0.001
+#define NF_PTH_CHUNK       64   // the number of nodes taken by a worker at a time
+#define NF_PTH_LEVEL_MIN  256   // smaller levels are processed by one thread
 
 typedef struct Nf_Cut_t_ Nf_Cut_t; 
 struct Nf_Cut_t_
@@ -112,12 +132,19 @@ struct Nf_Man_t_
     int             InvDelayI;      // inverter delay
     word            InvAreaW;       // inverter delay
     float           InvAreaF;       // inverter area 
+    void *          pPthMan;        // concurrent mapping manager
     // statistics
     abctime         clkStart;       // starting time
+    abctime         clkTruth;       // truth table computation time (sampled)
+    int             nTruthComps;    // the number of truth table computations (every 16th is timed)
     double          CutCount[6];    // cut counts
     int             nCutUseAll;     // objects with useful cuts
 };
 
+extern int                 Nf_ManPthIsApplicable( Nf_Man_t * p );
+extern int                 Nf_ManPthTtInsert( Nf_Man_t * p, word * pTruth );
+extern int                 Nf_ManPthNewPage( Nf_Man_t * p );
+
 static inline int          Nf_Cfg2Int( Nf_Cfg_t Mat )                                { union { int x; Nf_Cfg_t y; } v; v.y = Mat; return v.x;           }
 static inline Nf_Cfg_t     Nf_Int2Cfg( int Int )                                     { union { int x; Nf_Cfg_t y; } v; v.x = Int; return v.y;           }
 
@@ -461,9 +488,11 @@ static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t
     t1 = Abc_Tt6Expand( t1, pCut1->pLeaves, pCut1->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
     t =  fIsXor ? t0 ^ t1 : t0 & t1;
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
-    pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
+    // the support cannot shrink if the fanin cuts are disjoint and non-constant
+    if ( pCut0->nLeaves + pCut1->nLeaves > pCutR->nLeaves || pCut0->nLeaves == 0 || pCut1->nLeaves == 0 )
+        pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = p->pPthMan ? Nf_ManPthTtInsert(p, &t) : Vec_MemHashInsert(p->vTtMem, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -485,7 +514,7 @@ static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = p->pPthMan ? Nf_ManPthTtInsert(p, &t) : Vec_MemHashInsert(p->vTtMem, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -573,7 +602,7 @@ static inline int Nf_ManSaveCuts( Nf_Man_t * p, Nf_Cut_t ** pCuts, int nCuts, in
         if ( !fUseful || !pCuts[i]->Useless )
             nInts += pCuts[i]->nLeaves + 1, nCutsNew++;
     if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
-        p->iCur = ((p->iCur >> 16) + 1) << 16;
+        p->iCur = p->pPthMan ? Nf_ManPthNewPage(p) : ((p->iCur >> 16) + 1) << 16;
     if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
         Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
     iCur = p->iCur; p->iCur += nInts;
@@ -875,6 +904,8 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     int iSibl    = Gia_ObjSibl(p->pGia, iObj);
     Nf_Cut_t * pCut0, * pCut1, * pCut0Lim = pCuts0 + nCuts0, * pCut1Lim = pCuts1 + nCuts1;
     int i, nCutsUse, nCutsR = 0;
+    int fSample;
+    abctime clk;
     assert( !Gia_ObjIsBuf(pObj) );
     for ( i = 0; i < nCutNum; i++ )
         pCutsR[i] = pCuts + i;
@@ -912,8 +943,12 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
             if ( Nf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
             p->CutCount[2]++;
+            fSample = p->pPars->fVerbose && (++p->nTruthComps & 15) == 0;
+            clk = fSample ? Abc_Clock() : 0;
             if ( Nf_CutComputeTruthMux6(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                 pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+            if ( fSample )
+                p->clkTruth += Abc_Clock() - clk;
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
             nCutsR = Nf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
@@ -933,8 +968,12 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
             if ( Nf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
             p->CutCount[2]++;
+            fSample = p->pPars->fVerbose && (++p->nTruthComps & 15) == 0;
+            clk = fSample ? Abc_Clock() : 0;
             if ( Nf_CutComputeTruth6(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
                 pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+            if ( fSample )
+                p->clkTruth += Abc_Clock() - clk;
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
             nCutsR = Nf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
@@ -1037,6 +1076,8 @@ void Nf_ManPrintInit( Nf_Man_t * p )
     printf( "Funcs = %d  ",   Vec_MemEntryNum(p->vTtMem) );
     printf( "Matches = %d  ", Vec_WecSizeSize(p->vTt2Match)/2 );
     printf( "And = %d  ",     Gia_ManAndNum(p->pGia) );
+    if ( Nf_ManPthIsApplicable(p) )
+    printf( "Threads = %d  ", p->pPars->nProcNum );
     nChoices = Gia_ManChoiceNum( p->pGia );
     if ( nChoices )
     printf( "Choices = %d  ", nChoices );
@@ -1067,6 +1108,8 @@ void Nf_ManPrintQuit( Nf_Man_t * p )
     printf( "Cut = %.2f MB   ",         MemCuts );
     printf( "TT = %.2f MB  ",           MemTt ); 
     printf( "Total = %.2f MB   ",       MemGia + MemMan + MemCuts + MemTt ); 
+    if ( p->clkTruth )
+        printf( "Truth = %.2f Mcuts/sec   ", 1.0e-6 * (p->nTruthComps / 16) * CLOCKS_PER_SEC / p->clkTruth );
 //    printf( "\n" );
     Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
     fflush( stdout );
@@ -1443,6 +1486,263 @@ void Nf_ManComputeMapping( Nf_Man_t * p )
         }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Level-parallel cut computation and matching.]
+
+  Description [The cuts and the matches of a node depend only on the data
+  of its fanins, so the nodes of one level are processed concurrently.
+  Each worker uses a copy of the manager with its own statistics and its
+  own page of cut memory. The truth table hash table is shared and protected
+  by a lock. The resulting mapping does not depend on the number of threads.
+  The exact area recovery is performed by the calling thread afterwards.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+int  Nf_ManPthIsApplicable( Nf_Man_t * p )                { return 0;                                     }
+void Nf_ManPthComputeCuts( Nf_Man_t * p )                 { assert( 0 );                                  }
+void Nf_ManPthComputeMapping( Nf_Man_t * p )              { assert( 0 );                                  }
+int  Nf_ManPthTtInsert( Nf_Man_t * p, word * pTruth )     { return Vec_MemHashInsert( p->vTtMem, pTruth ); }
+int  Nf_ManPthNewPage( Nf_Man_t * p )                     { assert( 0 ); return 0;                        }
+
+#else // pthreads are used
+
+typedef struct Nf_PthMan_t_ Nf_PthMan_t;
+struct Nf_PthMan_t_
+{
+    Nf_Man_t *       pMan;        // the mapping manager
+    int              nWorkers;    // the number of workers
+    Nf_Man_t **      pWorkers;    // the copies of the manager used by the workers
+    pthread_mutex_t  MutexTt;     // the lock of the truth table hash table
+    pthread_mutex_t  MutexPage;   // the lock of the cut memory
+    Vec_Wec_t *      vLevels;     // the internal nodes by level
+    Vec_Int_t *      vLevel;      // the nodes of the current level
+    atomic_int       iNext;       // the next node of the level to be processed
+    int              fCuts;       // computing cuts (1) or matches (0)
+};
+
+int Nf_ManPthIsApplicable( Nf_Man_t * p )
+{
+    return p->pPars->nProcNum > 1 && !p->pManTim && !Gia_ManHasChoices(p->pGia) && !Gia_ManBufNum(p->pGia);
+}
+int Nf_ManPthTtInsert( Nf_Man_t * p, word * pTruth )
+{
+    Nf_PthMan_t * pPth = (Nf_PthMan_t *)p->pPthMan;
+    int truthId, status;
+    status = pthread_mutex_lock( &pPth->MutexTt );  assert( status == 0 );
+    truthId = Vec_MemHashInsert( p->vTtMem, pTruth );
+    status = pthread_mutex_unlock( &pPth->MutexTt );  assert( status == 0 );
+    return truthId;
+}
+int Nf_ManPthNewPage( Nf_Man_t * p )
+{
+    Nf_PthMan_t * pPth = (Nf_PthMan_t *)p->pPthMan;
+    Nf_Man_t * pMan = pPth->pMan;
+    int iPage, status;
+    status = pthread_mutex_lock( &pPth->MutexPage );  assert( status == 0 );
+    // the room for the new pages is reserved before each level, so the array is not moved
+    assert( Vec_PtrSize(&pMan->vPages) < Vec_PtrCap(&pMan->vPages) );
+    iPage = Vec_PtrSize(&pMan->vPages);
+    Vec_PtrPush( &pMan->vPages, ABC_ALLOC(int, (1<<16)) );
+    p->vPages = pMan->vPages;
+    status = pthread_mutex_unlock( &pPth->MutexPage );  assert( status == 0 );
+    // zero cut set ID means that the node has no cuts
+    return iPage ? iPage << 16 : 2;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes by level.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Nf_ManPthCollectLevels( Gia_Man_t * p )
+{
+    Vec_Wec_t * vLevels = Vec_WecAlloc( 100 );
+    Vec_Int_t * vLevel = Vec_IntStart( Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj; int i, Level;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevel, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevel, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(p, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Gia_ObjFaninId2(p, i)) );
+        Vec_IntWriteEntry( vLevel, i, Level + 1 );
+        Vec_WecPush( vLevels, Level, i );
+    }
+    Vec_IntFree( vLevel );
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the concurrent mapping manager.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Nf_PthMan_t * Nf_ManPthStart( Nf_Man_t * p, int fCuts )
+{
+    Nf_PthMan_t * pPth;
+    Nf_Man_t * pW;
+    int w, status;
+    assert( p->pPthMan == NULL );
+    pPth = ABC_CALLOC( Nf_PthMan_t, 1 );
+    pPth->pMan     = p;
+    pPth->nWorkers = p->pPars->nProcNum;
+    pPth->pWorkers = ABC_CALLOC( Nf_Man_t *, pPth->nWorkers );
+    pPth->vLevels  = Nf_ManPthCollectLevels( p->pGia );
+    pPth->fCuts    = fCuts;
+    status = pthread_mutex_init( &pPth->MutexTt, NULL );    assert( status == 0 );
+    status = pthread_mutex_init( &pPth->MutexPage, NULL );  assert( status == 0 );
+    for ( w = 0; w < pPth->nWorkers; w++ )
+    {
+        pW = pPth->pWorkers[w] = ABC_ALLOC( Nf_Man_t, 1 );
+        memcpy( pW, p, sizeof(Nf_Man_t) );
+        pW->pPthMan     = pPth;
+        pW->iCur        = 0xFFFF; // the first cut set goes to a new page
+        pW->clkTruth    = 0;
+        pW->nTruthComps = 0;
+        pW->nCutUseAll  = 0;
+        memset( pW->CutCount, 0, sizeof(double) * 6 );
+    }
+    return pPth;
+}
+void Nf_ManPthStop( Nf_PthMan_t * pPth )
+{
+    Nf_Man_t * p = pPth->pMan, * pW;
+    int w, i, status;
+    for ( w = 0; w < pPth->nWorkers; w++ )
+    {
+        pW = pPth->pWorkers[w];
+        p->clkTruth    += pW->clkTruth;
+        p->nTruthComps += pW->nTruthComps;
+        p->nCutUseAll  += pW->nCutUseAll;
+        for ( i = 0; i < 6; i++ )
+            p->CutCount[i] += pW->CutCount[i];
+        ABC_FREE( pW );
+    }
+    if ( pPth->fCuts )
+        p->iCur = Vec_PtrSize(&p->vPages) << 16;
+    status = pthread_mutex_destroy( &pPth->MutexTt );    assert( status == 0 );
+    status = pthread_mutex_destroy( &pPth->MutexPage );  assert( status == 0 );
+    Vec_WecFree( pPth->vLevels );
+    ABC_FREE( pPth->pWorkers );
+    ABC_FREE( pPth );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the nodes of one level.]
+
+  Description [The workers take the nodes of the level in chunks.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Nf_ManPthWorkerThread( void * pArg )
+{
+    Nf_Man_t * pW = (Nf_Man_t *)pArg;
+    Nf_PthMan_t * pPth = (Nf_PthMan_t *)pW->pPthMan;
+    int i, iStart, nNodes = Vec_IntSize(pPth->vLevel);
+    while ( (iStart = atomic_fetch_add( &pPth->iNext, NF_PTH_CHUNK )) < nNodes )
+        for ( i = iStart; i < Abc_MinInt(iStart + NF_PTH_CHUNK, nNodes); i++ )
+            if ( pPth->fCuts )
+                Nf_ObjMergeOrder( pW, Vec_IntEntry(pPth->vLevel, i) );
+            else
+                Nf_ManCutMatch( pW, Vec_IntEntry(pPth->vLevel, i) );
+    return NULL;
+}
+void Nf_ManPthProcessLevel( Nf_PthMan_t * pPth, Vec_Int_t * vLevel )
+{
+    pthread_t * pThreads;
+    int w, status;
+    pPth->vLevel = vLevel;
+    atomic_store( &pPth->iNext, 0 );
+    if ( Vec_IntSize(vLevel) < NF_PTH_LEVEL_MIN )
+    {
+        Nf_ManPthWorkerThread( pPth->pWorkers[0] );
+        return;
+    }
+    // the calling thread is the first worker
+    pThreads = ABC_ALLOC( pthread_t, pPth->nWorkers );
+    for ( w = 1; w < pPth->nWorkers; w++ )
+    {
+        status = pthread_create( pThreads + w, NULL, Nf_ManPthWorkerThread, (void *)pPth->pWorkers[w] );  assert( status == 0 );
+    }
+    Nf_ManPthWorkerThread( pPth->pWorkers[0] );
+    for ( w = 1; w < pPth->nWorkers; w++ )
+    {
+        status = pthread_join( pThreads[w], NULL );  assert( status == 0 );
+    }
+    ABC_FREE( pThreads );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts or the matches of all nodes by levels.]
+
+  Description [Before each level of cut computation, the calling thread
+  reserves the room for the new pages of cut memory (a cut set takes
+  less than 256 integers, so a page holds more than 256 cut sets) and 
+  for the new truth tables, so that the shared arrays are not moved while
+  the workers read them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nf_ManPthPerform( Nf_Man_t * p, int fCuts )
+{
+    Nf_PthMan_t * pPth;
+    Vec_Int_t * vLevel;
+    word nTruths, nCutNum = p->pPars->nCutNum + 1;
+    int k, w;
+    assert( Nf_ManPthIsApplicable(p) );
+    pPth = Nf_ManPthStart( p, fCuts );
+    Vec_WecForEachLevel( pPth->vLevels, vLevel, k )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        if ( fCuts )
+        {
+            Vec_PtrGrow( &p->vPages, Vec_PtrSize(&p->vPages) + pPth->nWorkers + Vec_IntSize(vLevel) / 256 + 1 );
+            for ( w = 0; w < pPth->nWorkers; w++ )
+                pPth->pWorkers[w]->vPages = p->vPages;
+            nTruths = (word)Vec_IntSize(vLevel) * nCutNum * nCutNum * (Gia_ManMuxNum(p->pGia) ? nCutNum : 1);
+            Vec_MemReserve( p->vTtMem, (int)Abc_MinWord((word)Vec_MemEntryNum(p->vTtMem) + nTruths, 0x7FFFFFFF) );
+        }
+        Nf_ManPthProcessLevel( pPth, vLevel );
+    }
+    Nf_ManPthStop( pPth );
+}
+void Nf_ManPthComputeCuts( Nf_Man_t * p )
+{
+    Nf_ManPthPerform( p, 1 );
+}
+void Nf_ManPthComputeMapping( Nf_Man_t * p )
+{
+    Nf_ManPthPerform( p, 0 );
+}
+
+#endif // pthreads are used
+
 
 /**Function*************************************************************
 
@@ -2465,7 +2765,10 @@ Gia_Man_t * Nf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
         printf( "Derived " );  Gia_ManPrintMuxStats( pCls );  printf( "\n" );
     }
     Nf_ManPrintInit( p );
-    Nf_ManComputeCuts( p );
+    if ( Nf_ManPthIsApplicable(p) )
+        Nf_ManPthComputeCuts( p );
+    else
+        Nf_ManComputeCuts( p );
     Nf_ManPrintQuit( p );
     if ( Scl_ConIsRunning() )
     {
@@ -2480,7 +2783,10 @@ Gia_Man_t * Nf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
     }
     for ( p->Iter = 0; p->Iter < p->pPars->nRounds; p->Iter++ )
     {
-        Nf_ManComputeMapping( p );
+        if ( Nf_ManPthIsApplicable(p) )
+            Nf_ManPthComputeMapping( p );
+        else
+            Nf_ManComputeMapping( p );
         Nf_ManSetMapRefs( p );
         Nf_ManPrintStats( p, (char *)(p->Iter ? "Area " : "Delay") );
     }
@@ -160,6 +160,9 @@ Abc_Ntk_t * Abc_NtkIf( Abc_Ntk_t * pNtk, If_Par_t * pPars )
         if ( pPars->fDsdBalance )
             If_DsdManAllocIsops( pIfMan->pIfDsdMan, pPars->nLutSize );
     }
+    // attach the cache of decomposability verdicts
+    if ( pPars->pFuncCell && !pPars->fUseDsd )
+        If_DecCacheAttach( pIfMan, (If_DecCache_t *)Abc_FrameReadManIfDec() );
 
     // perform FPGA mapping
     if ( !If_ManPerformMapping( pIfMan ) )
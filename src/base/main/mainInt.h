@@ -96,6 +96,8 @@ struct Abc_Frame_t_
     void *          pManDec;       // decomposition manager
     void *          pManDsd;       // decomposition manager
     void *          pManDsd2;      // decomposition manager
+    void *          pManIfDec;     // cache of decomposability verdicts
+    void *          pManIfInc;     // the result of the previous incremental mapping
     // libraries for mapping
     void *          pLibLut;       // the current LUT library
     void *          pLibBox;       // the current box library
@@ -302,6 +302,14 @@ extern DdNode *     extraZddTuplesFromBdd( DdManager * dd, DdNode * bVarsK, DdNo
 extern DdNode *    Extra_zddSelectOneSubset( DdManager * dd, DdNode * zS );
 extern DdNode *     extraZddSelectOneSubset( DdManager * dd, DdNode * zS );
 
+/*=== extraBddPar.c =================================================================*/
+
+typedef struct Extra_BddPar_t_  Extra_BddPar_t;
+extern Extra_BddPar_t * Extra_BddParStart( DdManager * dd, int nProcs, int nSizeMin );
+extern void        Extra_BddParStop( Extra_BddPar_t * p );
+extern DdNode *    Extra_bddAndAbstractPar( Extra_BddPar_t * p, DdNode * bF, DdNode * bG, DdNode * bCube );
+extern DdNode *    Extra_bddAndPar( Extra_BddPar_t * p, DdNode * bF, DdNode * bG );
+
 /*=== extraBddUnate.c =================================================================*/
 
 extern DdNode *    Extra_bddAndTime( DdManager * dd, DdNode * f, DdNode * g, int TimeOut );
@@ -0,0 +1,397 @@
+/**CFile****************************************************************
+
+  FileName    [extraBddPar.c]
+
+  PackageName [extra]
+
+  Synopsis    [Fork-join BDD operators using private managers of the threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 2.0. Started - September 1, 2003.]
+
+  Revision    [$Id: extraBddPar.c,v 1.0 2003/09/01 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "extraBdd.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+/*---------------------------------------------------------------------------*/
+/* Constant declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+#define EXTRA_PAR_SPLIT_MAX  10   // the largest number of cofactoring variables
+
+/*---------------------------------------------------------------------------*/
+/* Stucture declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+// The CUDD manager (unique table, computed table, node allocation, garbage
+// collection and reordering) assumes exclusive access. Instead of locking it,
+// each thread owns a private manager with the same variables and order. The
+// operands are cofactored w.r.t. a few top variables in the main manager,
+// the threads transfer the cofactors into their managers (reading the main
+// manager only, while the calling thread waits), solve the subproblems
+// independently, and the results are transferred back and combined.
+
+struct Extra_BddPar_t_
+{
+    DdManager *      dd;          // the main manager
+    int              nProcs;      // the number of threads
+    int              nSizeMin;    // the smallest total size of the operands to split
+    DdManager **     pDds;        // the private managers of the threads
+    // the current problem
+    int              nTasks;      // the number of subproblems
+    DdNode *         bCube;       // the cube to quantify (in the main manager)
+    DdNode **        pTaskF;      // the first cofactors (in the main manager)
+    DdNode **        pTaskG;      // the second cofactors (in the main manager)
+    DdNode **        pTaskRes;    // the results (in the private managers)
+    int *            pTaskDd;     // the private manager of each result
+#ifdef ABC_USE_PTHREADS
+    atomic_int       iNext;       // the next subproblem to solve
+#endif
+};
+
+typedef struct Extra_BddParThData_t_ Extra_BddParThData_t;
+struct Extra_BddParThData_t_
+{
+    Extra_BddPar_t * p;           // the parallel manager
+    int              iThread;     // the thread number
+};
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Macro declarations                                                        */
+/*---------------------------------------------------------------------------*/
+
+/**AutomaticStart*************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Static function prototypes                                                */
+/*---------------------------------------------------------------------------*/
+
+#ifdef ABC_USE_PTHREADS
+static void * Extra_BddParWorkerThread( void * pArg );
+#endif
+
+/**AutomaticEnd***************************************************************/
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of exported functions                                          */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Starts the parallel BDD manager.]
+
+  Description [Creates one private BDD manager for each thread. Operations
+  whose operands have less than nSizeMin nodes in total are performed
+  by the main manager.]
+
+  SideEffects []
+
+  SeeAlso     [Extra_BddParStop]
+
+******************************************************************************/
+Extra_BddPar_t * Extra_BddParStart( DdManager * dd, int nProcs, int nSizeMin )
+{
+    Extra_BddPar_t * p;
+    int i;
+    p = ABC_CALLOC( Extra_BddPar_t, 1 );
+    p->dd       = dd;
+    p->nProcs   = nProcs;
+    p->nSizeMin = nSizeMin;
+    p->pDds     = ABC_CALLOC( DdManager *, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        p->pDds[i] = Cudd_Init( dd->size, 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        Cudd_AutodynDisable( p->pDds[i] );
+    }
+    return p;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Stops the parallel BDD manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [Extra_BddParStart]
+
+******************************************************************************/
+void Extra_BddParStop( Extra_BddPar_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nProcs; i++ )
+        Extra_StopManager( p->pDds[i] );
+    ABC_FREE( p->pDds );
+    ABC_FREE( p );
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Computes the AND of two BDDs and abstracts the variables in cube.]
+
+  Description [Cofactors the operands w.r.t. a few top variables of their
+  joint support and solves the subproblems on several threads. Gives the
+  same function as Cudd_bddAndAbstract(). Returns NULL if the time limit
+  of the main manager is reached.]
+
+  SideEffects []
+
+  SeeAlso     [Cudd_bddAndAbstract Extra_bddAndPar]
+
+******************************************************************************/
+DdNode * Extra_bddAndAbstractPar( Extra_BddPar_t * p, DdNode * bF, DdNode * bG, DdNode * bCube )
+{
+#ifdef ABC_USE_PTHREADS
+    DdManager * dd = p->dd;
+    DdNode * pRes[1 << EXTRA_PAR_SPLIT_MAX];
+    DdNode * pOps[2], * bSplit, * bLits, * bVar, * bRes, * bTemp;
+    Extra_BddParThData_t ThData[64];
+    pthread_t WorkerThread[64];
+    int pVars[EXTRA_PAR_SPLIT_MAX];
+    int * pSupp, i, k, m, nVars, nSplits, nProcs, status, fFailed = 0;
+    if ( p->nProcs < 2 || Cudd_IsConstant(bF) || Cudd_IsConstant(bG) ||
+         Cudd_DagSize(bF) + Cudd_DagSize(bG) < p->nSizeMin )
+        return Cudd_bddAndAbstract( dd, bF, bG, bCube );
+    nProcs = Abc_MinInt( p->nProcs, 64 );
+    // select the top variables of the joint support; there are 2..4 subproblems per thread
+    nSplits = Abc_MinInt( Abc_Base2Log(nProcs) + 1, EXTRA_PAR_SPLIT_MAX );
+    pOps[0] = bF;  pOps[1] = bG;
+    pSupp = ABC_CALLOC( int, Abc_MaxInt(dd->size, dd->sizeZ) );
+    Extra_VectorSupportArray( dd, pOps, 2, pSupp );
+    for ( nVars = i = 0; i < dd->size && nVars < nSplits; i++ )
+        if ( pSupp[dd->invperm[i]] )
+            pVars[nVars++] = dd->invperm[i];
+    ABC_FREE( pSupp );
+    nSplits = nVars;
+    if ( nSplits == 0 )
+        return Cudd_bddAndAbstract( dd, bF, bG, bCube );
+    // synchronize the private managers with the main manager
+    for ( k = 0; k < nProcs; k++ )
+    {
+        DdManager * ddW = p->pDds[k];
+        while ( ddW->size < dd->size )
+            Cudd_bddNewVar( ddW );
+        for ( i = 0; i < dd->size; i++ )
+            if ( ddW->perm[i] != dd->perm[i] )
+                break;
+        if ( i < dd->size )
+            Cudd_ShuffleHeap( ddW, dd->invperm );
+        ddW->TimeStop = dd->TimeStop;
+    }
+    // derive the subproblems
+    bSplit = Cudd_ReadOne( dd );  Cudd_Ref( bSplit );
+    for ( i = 0; i < nSplits; i++ )
+    {
+        bSplit = Cudd_bddAnd( dd, bTemp = bSplit, Cudd_bddIthVar(dd, pVars[i]) );  Cudd_Ref( bSplit );
+        Cudd_RecursiveDeref( dd, bTemp );
+    }
+    p->bCube = Cudd_bddExistAbstract( dd, bCube, bSplit );  Cudd_Ref( p->bCube );
+    p->nTasks   = 1 << nSplits;
+    p->pTaskF   = ABC_CALLOC( DdNode *, p->nTasks );
+    p->pTaskG   = ABC_CALLOC( DdNode *, p->nTasks );
+    p->pTaskRes = ABC_CALLOC( DdNode *, p->nTasks );
+    p->pTaskDd  = ABC_CALLOC( int, p->nTasks );
+    for ( m = 0; m < p->nTasks; m++ )
+    {
+        bLits = Cudd_ReadOne( dd );  Cudd_Ref( bLits );
+        for ( i = 0; i < nSplits; i++ )
+        {
+            bVar  = Cudd_NotCond( Cudd_bddIthVar(dd, pVars[i]), !((m >> i) & 1) );
+            bLits = Cudd_bddAnd( dd, bTemp = bLits, bVar );  Cudd_Ref( bLits );
+            Cudd_RecursiveDeref( dd, bTemp );
+        }
+        p->pTaskF[m] = Cudd_Cofactor( dd, bF, bLits );  Cudd_Ref( p->pTaskF[m] );
+        p->pTaskG[m] = Cudd_Cofactor( dd, bG, bLits );  Cudd_Ref( p->pTaskG[m] );
+        Cudd_RecursiveDeref( dd, bLits );
+    }
+    // solve the subproblems; the calling thread is the first worker
+    atomic_store( &p->iNext, 0 );
+    nProcs = Abc_MinInt( nProcs, p->nTasks );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        ThData[k].p       = p;
+        ThData[k].iThread = k;
+    }
+    for ( k = 1; k < nProcs; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Extra_BddParWorkerThread, (void *)(ThData + k) );  assert( status == 0 );
+    }
+    Extra_BddParWorkerThread( ThData );
+    for ( k = 1; k < nProcs; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+    }
+    // transfer the results back
+    for ( m = 0; m < p->nTasks; m++ )
+    {
+        Cudd_RecursiveDeref( dd, p->pTaskF[m] );
+        Cudd_RecursiveDeref( dd, p->pTaskG[m] );
+        pRes[m] = NULL;
+        if ( p->pTaskRes[m] == NULL )
+        {
+            fFailed = 1;
+            continue;
+        }
+        if ( !fFailed )
+        {
+            pRes[m] = Cudd_bddTransfer( p->pDds[p->pTaskDd[m]], dd, p->pTaskRes[m] );
+            if ( pRes[m] == NULL )
+                fFailed = 1;
+            else
+                Cudd_Ref( pRes[m] );
+        }
+        Cudd_RecursiveDeref( p->pDds[p->pTaskDd[m]], p->pTaskRes[m] );
+    }
+    Cudd_RecursiveDeref( dd, p->bCube );
+    ABC_FREE( p->pTaskF );
+    ABC_FREE( p->pTaskG );
+    ABC_FREE( p->pTaskRes );
+    ABC_FREE( p->pTaskDd );
+    // combine the results, starting from the bottom split variable
+    for ( i = nSplits - 1; i >= 0; i-- )
+    for ( m = 0; m < (1 << i); m++ )
+    {
+        if ( fFailed )
+            bRes = NULL;
+        else if ( Cudd_bddLeq(dd, bCube, Cudd_bddIthVar(dd, pVars[i])) ) // quantified variable
+            bRes = Cudd_bddOr( dd, pRes[m], pRes[m | (1 << i)] );
+        else
+            bRes = Cudd_bddIte( dd, Cudd_bddIthVar(dd, pVars[i]), pRes[m | (1 << i)], pRes[m] );
+        if ( bRes == NULL )
+            fFailed = 1;
+        else
+            Cudd_Ref( bRes );
+        if ( pRes[m] )                Cudd_RecursiveDeref( dd, pRes[m] );
+        if ( pRes[m | (1 << i)] )     Cudd_RecursiveDeref( dd, pRes[m | (1 << i)] );
+        pRes[m] = bRes;
+    }
+    Cudd_RecursiveDeref( dd, bSplit );
+    if ( fFailed )
+    {
+        if ( pRes[0] )
+            Cudd_RecursiveDeref( dd, pRes[0] );
+        return NULL;
+    }
+    Cudd_Deref( pRes[0] );
+    return pRes[0];
+#else
+    return Cudd_bddAndAbstract( p->dd, bF, bG, bCube );
+#endif
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Computes the AND of two BDDs using several threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [Cudd_bddAnd Extra_bddAndAbstractPar]
+
+******************************************************************************/
+DdNode * Extra_bddAndPar( Extra_BddPar_t * p, DdNode * bF, DdNode * bG )
+{
+    return Extra_bddAndAbstractPar( p, bF, bG, Cudd_ReadOne(p->dd) );
+}
+
+/*---------------------------------------------------------------------------*/
+/* Definition of internal functions                                          */
+/*---------------------------------------------------------------------------*/
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function********************************************************************
+
+  Synopsis    [Solves the subproblems in the private manager of one thread.]
+
+  Description [Only reads the main manager. The result is NULL if the
+  time limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static void * Extra_BddParWorkerThread( void * pArg )
+{
+    Extra_BddParThData_t * pThData = (Extra_BddParThData_t *)pArg;
+    Extra_BddPar_t * p = pThData->p;
+    DdManager * ddW = p->pDds[pThData->iThread];
+    DdNode * bF, * bG, * bCube, * bRes;
+    int m;
+    while ( (m = atomic_fetch_add( &p->iNext, 1 )) < p->nTasks )
+    {
+        p->pTaskDd[m] = pThData->iThread;
+        bF = Cudd_bddTransfer( p->dd, ddW, p->pTaskF[m] );
+        if ( bF == NULL )
+            continue;
+        Cudd_Ref( bF );
+        bG = Cudd_bddTransfer( p->dd, ddW, p->pTaskG[m] );
+        if ( bG == NULL )
+        {
+            Cudd_RecursiveDeref( ddW, bF );
+            continue;
+        }
+        Cudd_Ref( bG );
+        bCube = Cudd_bddTransfer( p->dd, ddW, p->bCube );
+        if ( bCube == NULL )
+        {
+            Cudd_RecursiveDeref( ddW, bF );
+            Cudd_RecursiveDeref( ddW, bG );
+            continue;
+        }
+        Cudd_Ref( bCube );
+        bRes = Cudd_bddAndAbstract( ddW, bF, bG, bCube );
+        if ( bRes != NULL )
+            Cudd_Ref( bRes );
+        Cudd_RecursiveDeref( ddW, bF );
+        Cudd_RecursiveDeref( ddW, bG );
+        Cudd_RecursiveDeref( ddW, bCube );
+        p->pTaskRes[m] = bRes;
+    }
+    return NULL;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                           END OF FILE                            ///
+////////////////////////////////////////////////////////////////////////
+ABC_NAMESPACE_IMPL_END
@@ -47,6 +47,7 @@ void Llb_ManSetDefaultParams( Gia_ParLlb_t * p )
 {
     memset( p, 0, sizeof(Gia_ParLlb_t) );
     p->nBddMax       = 10000000;
+    p->nProcs        =        1;
     p->nIterMax      = 10000000;
     p->nClusterMax   =       20;
     p->nHintDepth    =        0;
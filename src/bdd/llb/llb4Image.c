@@ -49,6 +49,7 @@ struct Llb_Mgr_t_
     DdManager *   dd;        // working BDD manager
     Vec_Int_t *   vVars2Q;   // variables to quantify
     int           nSizeMax;  // maximum size of the cluster
+    Extra_BddPar_t * pPar;   // private managers of the threads (or NULL)
     // internal
     Llb_Prt_t **  pParts;    // partitions
     Llb_Var_t **  pVars;     // variables
@@ -343,7 +344,10 @@ printf( "Conjoining partitions %d and %d.\n", pPart1->iPart, pPart2->iPart );
 Extra_bddPrintSupport( p->dd, bCube );  printf( "\n" );
 }
 liveBeg = p->dd->keys - p->dd->dead;
-    bFunc = Cudd_bddAndAbstract( p->dd, pPart1->bFunc, pPart2->bFunc, bCube );  
+    if ( p->pPar )
+        bFunc = Extra_bddAndAbstractPar( p->pPar, pPart1->bFunc, pPart2->bFunc, bCube );  
+    else
+        bFunc = Cudd_bddAndAbstract( p->dd, pPart1->bFunc, pPart2->bFunc, bCube );  
 liveEnd = p->dd->keys - p->dd->dead;
 //printf( "%d ", liveEnd-liveBeg );
 
@@ -749,7 +753,7 @@ void Llb_Nonlin4Free( Llb_Mgr_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-DdNode * Llb_Nonlin4Image( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent, Vec_Int_t * vVars2Q )
+DdNode * Llb_Nonlin4Image( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent, Vec_Int_t * vVars2Q, Extra_BddPar_t * pPar )
 {
     Llb_Prt_t * pPart, * pPart1, * pPart2;
     Llb_Mgr_t * p;
@@ -757,6 +761,7 @@ DdNode * Llb_Nonlin4Image( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent
     int i, nReorders;
     // start the manager
     p = Llb_Nonlin4Alloc( dd, vParts, bCurrent, vVars2Q, 0 );
+    p->pPar = pPar;
     // remove singles
     Llb_MgrForEachPart( p, pPart, i )
         if ( Llb_Nonlin4HasSingletonVars(p, pPart) )
@@ -781,7 +786,17 @@ DdNode * Llb_Nonlin4Image( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent
     bFunc = Cudd_ReadOne(p->dd);   Cudd_Ref( bFunc );
     Llb_MgrForEachPart( p, pPart, i )
     {
-        bFunc = Cudd_bddAnd( p->dd, bTemp = bFunc, pPart->bFunc );   Cudd_Ref( bFunc );
+        if ( p->pPar )
+            bFunc = Extra_bddAndPar( p->pPar, bTemp = bFunc, pPart->bFunc );
+        else
+            bFunc = Cudd_bddAnd( p->dd, bTemp = bFunc, pPart->bFunc );
+        if ( bFunc == NULL )
+        {
+            Cudd_RecursiveDeref( p->dd, bTemp );
+            Llb_Nonlin4Free( p );
+            return NULL;
+        }
+        Cudd_Ref( bFunc );
         Cudd_RecursiveDeref( p->dd, bTemp );
     }
 //    nSuppMax = p->nSuppMax;
@@ -22,6 +22,24 @@
 #include "base/abc/abc.h"
 #include "aig/gia/giaAig.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
  
 
@@ -29,6 +47,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+typedef struct Llb_MnxPth_t_ Llb_MnxPth_t;
+
 typedef struct Llb_Mnx_t_ Llb_Mnx_t;
 struct Llb_Mnx_t_
 {
@@ -38,6 +58,8 @@ struct Llb_Mnx_t_
 
     // intermediate BDDs
     DdManager *     dd;             // BDD manager
+    Extra_BddPar_t * pPar;          // private BDD managers of the threads
+    Llb_MnxPth_t *  pPth;           // private BDD managers for the frontier parts
     DdNode *        bBad;           // bad states in terms of CIs
     DdNode *        bReached;       // reached states 
     DdNode *        bCurrent;       // from states
@@ -56,6 +78,33 @@ struct Llb_Mnx_t_
     abctime         timeTotal;
 };
 
+#define LLB_PAR_SIZE_MIN  5000  // the smallest operands of image computation split among the threads
+#define LLB_PART_SIZE_MIN 1000  // the smallest frontier split into parts imaged by the threads
+
+#ifdef ABC_USE_PTHREADS
+
+struct Llb_MnxPth_t_
+{
+    Llb_Mnx_t *     pMnx;           // reachability manager
+    int             nWorkers;       // the number of threads
+    DdManager **    pDds;           // the BDD managers of the threads
+    Vec_Ptr_t **    pvRoots;        // the partitions in the BDD managers of the threads
+    int             nTasks;         // the number of frontier parts
+    DdNode **       pTaskIn;        // the frontier parts (in the main manager)
+    DdNode **       pTaskOut;       // the images of the parts (in the managers of the threads)
+    int *           pTaskDd;        // the manager holding the image of each part
+    atomic_int      iNext;          // the next part to image
+};
+
+typedef struct Llb_MnxThData_t_ Llb_MnxThData_t;
+struct Llb_MnxThData_t_
+{
+    Llb_MnxPth_t *  pPth;           // the thread manager
+    int             iThread;        // the thread number
+};
+
+#endif
+
 //extern int timeBuild, timeAndEx, timeOther;
 //extern int nSuppMax;
 
@@ -620,7 +669,7 @@ Vec_Ptr_t * Llb_Nonlin4DeriveCex( Llb_Mnx_t * p, int fBackward, int fVerbose )
         Cudd_RecursiveDeref( p->dd, bState );
 
         // compute the next states
-        bImage = Llb_Nonlin4Image( p->dd, vRootsNew, NULL, vVars2Q ); Cudd_Ref( bImage );
+        bImage = Llb_Nonlin4Image( p->dd, vRootsNew, NULL, vVars2Q, NULL ); Cudd_Ref( bImage );
         Llb_Nonlin4Deref( p->dd, vRootsNew );
 
         // intersect with the previous set
@@ -656,6 +705,199 @@ Vec_Ptr_t * Llb_Nonlin4DeriveCex( Llb_Mnx_t * p, int fBackward, int fVerbose )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the image by parts of the frontier on several threads.]
+
+  Description [Each thread owns a BDD manager with its own copy of the
+  partitions and its own dynamic reordering. The frontier is split into
+  disjoint parts by its top variables. Each thread transfers a part into
+  its manager, computes the image there, and the images are transferred
+  back and ORed by the calling thread. Returns the image in the main
+  manager (not referenced) or NULL if the time limit is reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+Llb_MnxPth_t * Llb_Nonlin4PthStart( Llb_Mnx_t * p )
+{
+    Llb_MnxPth_t * pPth;
+    DdNode * bFunc;
+    int i, k;
+    pPth = ABC_CALLOC( Llb_MnxPth_t, 1 );
+    pPth->pMnx     = p;
+    pPth->nWorkers = p->pPars->nProcs;
+    pPth->pDds     = ABC_CALLOC( DdManager *, pPth->nWorkers );
+    pPth->pvRoots  = ABC_CALLOC( Vec_Ptr_t *, pPth->nWorkers );
+    for ( i = 0; i < pPth->nWorkers; i++ )
+    {
+        pPth->pDds[i] = Cudd_Init( Cudd_ReadSize(p->dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        Cudd_ShuffleHeap( pPth->pDds[i], p->dd->invperm );
+        Cudd_AutodynEnable( pPth->pDds[i],  CUDD_REORDER_SYMM_SIFT );
+        Cudd_SetMaxGrowth( pPth->pDds[i], 1.05 );
+        pPth->pDds[i]->TimeStop = p->dd->TimeStop;
+        pPth->pvRoots[i] = Vec_PtrAlloc( Vec_PtrSize(p->vRoots) );
+        Vec_PtrForEachEntry( DdNode *, p->vRoots, bFunc, k )
+        {
+            bFunc = Cudd_bddTransfer( p->dd, pPth->pDds[i], bFunc );  Cudd_Ref( bFunc );
+            Vec_PtrPush( pPth->pvRoots[i], bFunc );
+        }
+    }
+    return pPth;
+}
+void Llb_Nonlin4PthStop( Llb_MnxPth_t * pPth )
+{
+    DdNode * bFunc;
+    int i, k;
+    for ( i = 0; i < pPth->nWorkers; i++ )
+    {
+        Vec_PtrForEachEntry( DdNode *, pPth->pvRoots[i], bFunc, k )
+            Cudd_RecursiveDeref( pPth->pDds[i], bFunc );
+        Vec_PtrFree( pPth->pvRoots[i] );
+        Extra_StopManager( pPth->pDds[i] );
+    }
+    ABC_FREE( pPth->pvRoots );
+    ABC_FREE( pPth->pDds );
+    ABC_FREE( pPth );
+}
+void * Llb_Nonlin4PthWorkerThread( void * pArg )
+{
+    Llb_MnxThData_t * pThData = (Llb_MnxThData_t *)pArg;
+    Llb_MnxPth_t * pPth = pThData->pPth;
+    DdManager * ddW = pPth->pDds[pThData->iThread];
+    DdNode * bPart, * bImage;
+    int m;
+    while ( (m = atomic_fetch_add( &pPth->iNext, 1 )) < pPth->nTasks )
+    {
+        pPth->pTaskDd[m] = pThData->iThread;
+        if ( pPth->pTaskIn[m] == Cudd_ReadLogicZero(pPth->pMnx->dd) )
+        {
+            pPth->pTaskOut[m] = Cudd_ReadLogicZero( ddW );  Cudd_Ref( pPth->pTaskOut[m] );
+            continue;
+        }
+        bPart = Cudd_bddTransfer( pPth->pMnx->dd, ddW, pPth->pTaskIn[m] );
+        if ( bPart == NULL )
+            continue;
+        Cudd_Ref( bPart );
+        bImage = Llb_Nonlin4Image( ddW, pPth->pvRoots[pThData->iThread], bPart, pPth->pMnx->vVars2Q, NULL );
+        if ( bImage != NULL )
+            Cudd_Ref( bImage );
+        Cudd_RecursiveDeref( ddW, bPart );
+        pPth->pTaskOut[m] = bImage;
+    }
+    return NULL;
+}
+DdNode * Llb_Nonlin4PthImage( Llb_Mnx_t * p )
+{
+    Llb_MnxPth_t * pPth = p->pPth;
+    Llb_MnxThData_t ThData[64];
+    pthread_t WorkerThread[64];
+    DdManager * dd = p->dd;
+    DdNode * bLits, * bVar, * bImage, * bTemp, * bRes;
+    int * pSupp, pVars[16], i, k, m, nVars, nSplits, nProcs, status, fFailed = 0;
+    // select the top variables of the frontier; there are 2..4 parts per thread
+    nProcs  = Abc_MinInt( pPth->nWorkers, 64 );
+    nSplits = Abc_MinInt( Abc_Base2Log(nProcs) + 1, 16 );
+    pSupp = ABC_CALLOC( int, Abc_MaxInt(dd->size, dd->sizeZ) );
+    Extra_SupportArray( dd, p->bCurrent, pSupp );
+    for ( nVars = i = 0; i < dd->size && nVars < nSplits; i++ )
+        if ( pSupp[dd->invperm[i]] )
+            pVars[nVars++] = dd->invperm[i];
+    ABC_FREE( pSupp );
+    if ( nVars == 0 )
+        return Llb_Nonlin4Image( dd, p->vRoots, p->bCurrent, p->vVars2Q, p->pPar );
+    nSplits = nVars;
+    // derive the parts of the frontier
+    pPth->nTasks   = 1 << nSplits;
+    pPth->pTaskIn  = ABC_CALLOC( DdNode *, pPth->nTasks );
+    pPth->pTaskOut = ABC_CALLOC( DdNode *, pPth->nTasks );
+    pPth->pTaskDd  = ABC_CALLOC( int, pPth->nTasks );
+    for ( m = 0; m < pPth->nTasks; m++ )
+    {
+        bLits = Cudd_ReadOne( dd );  Cudd_Ref( bLits );
+        for ( i = 0; i < nSplits; i++ )
+        {
+            bVar  = Cudd_NotCond( Cudd_bddIthVar(dd, pVars[i]), !((m >> i) & 1) );
+            bLits = Cudd_bddAnd( dd, bTemp = bLits, bVar );  Cudd_Ref( bLits );
+            Cudd_RecursiveDeref( dd, bTemp );
+        }
+        pPth->pTaskIn[m] = Cudd_bddAnd( dd, p->bCurrent, bLits );  Cudd_Ref( pPth->pTaskIn[m] );
+        Cudd_RecursiveDeref( dd, bLits );
+    }
+    // image the parts; the calling thread is the first worker
+    atomic_store( &pPth->iNext, 0 );
+    nProcs = Abc_MinInt( nProcs, pPth->nTasks );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        ThData[k].pPth    = pPth;
+        ThData[k].iThread = k;
+    }
+    for ( k = 1; k < nProcs; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Llb_Nonlin4PthWorkerThread, (void *)(ThData + k) );  assert( status == 0 );
+    }
+    Llb_Nonlin4PthWorkerThread( ThData );
+    for ( k = 1; k < nProcs; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+    }
+    // transfer the images back and OR them
+    bRes = Cudd_ReadLogicZero( dd );  Cudd_Ref( bRes );
+    for ( m = 0; m < pPth->nTasks; m++ )
+    {
+        Cudd_RecursiveDeref( dd, pPth->pTaskIn[m] );
+        if ( pPth->pTaskOut[m] == NULL )
+        {
+            fFailed = 1;
+            continue;
+        }
+        if ( !fFailed )
+        {
+            bImage = Cudd_bddTransfer( pPth->pDds[pPth->pTaskDd[m]], dd, pPth->pTaskOut[m] );
+            if ( bImage == NULL )
+                fFailed = 1;
+            else
+            {
+                Cudd_Ref( bImage );
+                bRes = Cudd_bddOr( dd, bTemp = bRes, bImage );
+                if ( bRes == NULL )
+                    fFailed = 1;
+                else
+                    Cudd_Ref( bRes );
+                Cudd_RecursiveDeref( dd, bTemp );
+                Cudd_RecursiveDeref( dd, bImage );
+            }
+        }
+        Cudd_RecursiveDeref( pPth->pDds[pPth->pTaskDd[m]], pPth->pTaskOut[m] );
+    }
+    ABC_FREE( pPth->pTaskIn );
+    ABC_FREE( pPth->pTaskOut );
+    ABC_FREE( pPth->pTaskDd );
+    if ( fFailed )
+    {
+        if ( bRes )
+            Cudd_RecursiveDeref( dd, bRes );
+        return NULL;
+    }
+    Cudd_Deref( bRes );
+    return bRes;
+}
+
+#endif
+
+DdNode * Llb_Nonlin4ImageFrontier( Llb_Mnx_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pPth && Cudd_DagSize(p->bCurrent) >= LLB_PART_SIZE_MIN )
+        return Llb_Nonlin4PthImage( p );
+#endif
+    return Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q, p->pPar );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Perform reachability with hints.]
@@ -770,7 +1012,7 @@ int Llb_Nonlin4Reachability( Llb_Mnx_t * p )
 
         // compute the next states
         clkTemp = Abc_Clock();
-        p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
+        p->bNext = Llb_Nonlin4ImageFrontier( p );
         if ( p->bNext == NULL )
         {
             if ( !p->pPars->fSilent )
@@ -973,6 +1215,13 @@ Llb_Mnx_t * Llb_MnxStart( Aig_Man_t * pAig, Gia_ParLlb_t * pPars )
 
     if ( pPars->fReorder )
         Llb_Nonlin4Reorder( p->dd, 0, 1 );
+#ifdef ABC_USE_PTHREADS
+    if ( pPars->nProcs > 1 && pPars->fPartImage )
+        p->pPth = Llb_Nonlin4PthStart( p );
+    else
+#endif
+    if ( pPars->nProcs > 1 )
+        p->pPar = Extra_BddParStart( p->dd, pPars->nProcs, LLB_PAR_SIZE_MIN );
     return p;
 }
  
@@ -1020,6 +1269,12 @@ void Llb_MnxStop( Llb_Mnx_t * p )
     Vec_PtrFreeP( &p->vRings );
     Vec_PtrFreeP( &p->vRoots );
 //Cudd_PrintInfo( p->dd, stdout );
+    if ( p->pPar )
+        Extra_BddParStop( p->pPar );
+#ifdef ABC_USE_PTHREADS
+    if ( p->pPth )
+        Llb_Nonlin4PthStop( p->pPth );
+#endif
     Extra_StopManager( p->dd );
     Vec_IntFreeP( &p->vOrder );
     Vec_IntFreeP( &p->vVars2Q );
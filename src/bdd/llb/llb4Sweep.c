@@ -397,7 +397,7 @@ DdManager * Llb4_Nonlin4SweepBadStates( Aig_Man_t * pAig, Vec_Int_t * vOrder, in
     // compute image of the partitions
     bMonitor = Llb4_Nonlin4SweepBadMonitor( pAig, vOrder, dd );  Cudd_Ref( bMonitor );
     Cudd_AutodynEnable( dd,  CUDD_REORDER_SYMM_SIFT );
-    bImage = Llb_Nonlin4Image( dd, vParts, bMonitor, vVars2Q );  Cudd_Ref( bImage );
+    bImage = Llb_Nonlin4Image( dd, vParts, bMonitor, vVars2Q, NULL );  Cudd_Ref( bImage );
     Cudd_RecursiveDeref( dd, bMonitor );
     Llb_Nonlin4SweepDeref( dd, vParts );
     Vec_IntFree( vVars2Q );
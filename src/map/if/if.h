@@ -82,6 +82,8 @@ typedef struct If_Set_t_     If_Set_t;
 typedef struct If_LibLut_t_  If_LibLut_t;
 typedef struct If_LibBox_t_  If_LibBox_t;
 typedef struct If_DsdMan_t_  If_DsdMan_t;
+typedef struct If_DecCache_t_ If_DecCache_t;
+typedef struct If_IncMan_t_   If_IncMan_t;
 typedef struct Ifn_Ntk_t_    Ifn_Ntk_t;
 
 typedef struct Ifif_Par_t_   Ifif_Par_t;
@@ -114,6 +116,8 @@ struct If_Par_t_
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
     int                nLutDecSize;   // the LUT size for decomposition
+    int                nThreads;      // the number of threads for cut computation
+    int                fIncremental;  // reuse the mapping of the unchanged nodes from the previous run
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -217,6 +221,7 @@ struct If_Man_t_
     float              dPower;        // the sum total of switching activities of all LUTs in the mapping
     int                nCutsUsed;     // the number of cuts currently used
     int                nCutsMerged;   // the total number of cuts merged
+    int                nCutsTruth;    // the total number of truth table computations
     unsigned *         puTemp[4];     // used for the truth table computation
     word *             puTempW;       // used for the truth table computation
     int                SortMode;      // one of the three sorting modes
@@ -250,6 +255,7 @@ struct If_Man_t_
     If_Set_t *         pMemCi;        // memory for CI cutsets
     If_Set_t *         pMemAnd;       // memory for AND cutsets
     If_Set_t *         pFreeList;     // the list of free cutsets
+    Vec_Ptr_t *        vMemAnds;      // additional memory for AND cutsets
     int                nSmallSupp;    // the small support
     int                nCutsTotal;
     int                nCutsUseless[32];
@@ -258,6 +264,9 @@ struct If_Man_t_
     int                nCutsUselessAll;
     int                nCuts5, nCuts5a;
     If_DsdMan_t *      pIfDsdMan;     // DSD manager
+    If_DecCache_t *    pIfDecCache;   // cache of decomposability verdicts
+    void *             pIfDecTab;     // verdicts of the current cut-function check
+    Vec_Bit_t *        vFrozen;       // nodes whose mapping is taken from the previous run
     Vec_Mem_t *        vTtMem[IF_MAX_FUNC_LUTSIZE+1];   // truth table memory and hash table
     Vec_Wec_t *        vTtIsops[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into DSD
     Vec_Int_t *        vTtDsds[IF_MAX_FUNC_LUTSIZE+1];  // mapping of truth table into DSD
@@ -285,6 +294,8 @@ struct If_Man_t_
     Vec_Str_t *        vMarks;
     Vec_Int_t *        vVisited2;
 
+    void *             pPthMan;       // concurrent mapping manager (set in the worker copies)
+
     // timing manager
     Tim_Man_t *        pManTim;
     Vec_Int_t *        vCoAttrs;      // CO attributes   0=optimize; 1=keep; 2=relax
@@ -431,6 +442,7 @@ static inline If_Cut_t * If_ObjCutBest( If_Obj_t * pObj )                    { r
 static inline unsigned   If_ObjCutSign( unsigned ObjId )                     { return (1 << (ObjId % 31));           }
 static inline unsigned   If_ObjCutSignCompute( If_Cut_t * p )                { unsigned s = 0; int i; for ( i = 0; i < If_CutLeaveNum(p); i++ ) s |= If_ObjCutSign(p->pLeaves[i]); return s; }
 
+static inline int        If_ObjIsFrozen( If_Man_t * p, If_Obj_t * pObj )    { return p->vFrozen && Vec_BitEntry(p->vFrozen, pObj->Id); }
 static inline float      If_ObjArrTime( If_Obj_t * pObj )                    { return If_ObjCutBest(pObj)->Delay;    }
 static inline void       If_ObjSetArrTime( If_Obj_t * pObj, float ArrTime )  { If_ObjCutBest(pObj)->Delay = ArrTime; }
 
@@ -567,6 +579,19 @@ extern int             If_CluCheckXXExt( void * p, word * pTruth, int nVars, int
                            char * pLut0, char * pLut1, word * pFunc0, word * pFunc1 );
 extern int             If_MatchCheck1( If_Man_t * p, unsigned * pTruth, int nVars, int nLeaves, char * pStr );
 extern int             If_MatchCheck2( If_Man_t * p, unsigned * pTruth, int nVars, int nLeaves, char * pStr );
+/*=== ifDecCache.c ========================================================*/
+extern If_DecCache_t * If_DecCacheAlloc();
+extern void            If_DecCacheFree( If_DecCache_t * p );
+extern void            If_DecCacheAttach( If_Man_t * p, If_DecCache_t * pCache );
+extern int             If_DecCacheCheck( If_Man_t * p, If_Cut_t * pCut );
+extern void            If_DecCachePrint( If_DecCache_t * p );
+extern int             If_DecCacheLoad( If_DecCache_t * p, char * pFileName );
+extern int             If_DecCacheSave( If_DecCache_t * p, char * pFileName );
+/*=== ifInc.c ============================================================*/
+extern If_IncMan_t *   If_ManIncDerive( If_Man_t * p );
+extern void            If_ManIncFree( If_IncMan_t * p );
+extern int             If_ManIncAttach( If_Man_t * p, If_IncMan_t * pInc );
+extern void            If_ObjPerformMappingFrozen( If_Man_t * p, If_Obj_t * pObj, int Mode );
 /*=== ifDelay.c =============================================================*/
 extern int             If_CutDelaySop( If_Man_t * p, If_Cut_t * pCut );
 extern int             If_CutSopBalanceEvalInt( Vec_Int_t * vCover, int * pTimes, int * pFaninLits, Vec_Int_t * vAig, int * piRes, int nSuppAll, int * pArea );
@@ -655,6 +680,10 @@ extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
+/*=== ifPth.c =============================================================*/
+extern int             If_ManPthIsApplicable( If_Man_t * p, int Mode );
+extern void            If_ManPthPerformMappingRound( If_Man_t * p, int Mode, int fPreprocess, int fFirst );
+extern int             If_ManPthTtInsert( If_Man_t * p, int nLeaves, word * pTruth );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
 /*=== ifSat.c ==========================================================*/
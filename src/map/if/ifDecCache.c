@@ -0,0 +1,445 @@
+/**CFile****************************************************************
+
+  FileName    [ifDecCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [On-disk cache of the decomposability checks of cut functions.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: ifDecCache.c,v 1.00 2026/10/19 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "if.h"
+#include "misc/util/utilSignal.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define DEC_VERSION "dec1"
+
+// verdicts of one cut-function check (for example, "-S 44" with 8-input cuts)
+typedef struct If_DecTab_t_ If_DecTab_t;
+struct If_DecTab_t_
+{
+    char *             pName;         // the check used to derive verdicts
+    Vec_Mem_t *        vTtMem[IF_MAX_FUNC_LUTSIZE+1]; // truth tables by support size
+    Vec_Str_t *        vVerds[IF_MAX_FUNC_LUTSIZE+1]; // verdicts by support size
+};
+
+// the cache shared by all mapper runs in the session
+struct If_DecCache_t_
+{
+    Vec_Ptr_t *        vTabs;         // verdict tables
+    int                nHits;         // the number of cache hits
+    int                nMisses;       // the number of cache misses
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Allocating and freeing the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_DecCache_t * If_DecCacheAlloc()
+{
+    If_DecCache_t * p = ABC_CALLOC( If_DecCache_t, 1 );
+    p->vTabs = Vec_PtrAlloc( 4 );
+    return p;
+}
+static If_DecTab_t * If_DecTabAlloc( char * pName )
+{
+    If_DecTab_t * p = ABC_CALLOC( If_DecTab_t, 1 );
+    int v;
+    p->pName = Abc_UtilStrsav( pName );
+    for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+    {
+        p->vTtMem[v] = Vec_MemAlloc( Abc_Truth6WordNum(v), 12 );
+        Vec_MemHashAlloc( p->vTtMem[v], 1000 );
+        p->vVerds[v] = Vec_StrAlloc( 1000 );
+    }
+    return p;
+}
+static void If_DecTabFree( If_DecTab_t * p )
+{
+    int v;
+    for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+    {
+        Vec_MemHashFree( p->vTtMem[v] );
+        Vec_MemFree( p->vTtMem[v] );
+        Vec_StrFree( p->vVerds[v] );
+    }
+    ABC_FREE( p->pName );
+    ABC_FREE( p );
+}
+void If_DecCacheFree( If_DecCache_t * p )
+{
+    If_DecTab_t * pTab; int i;
+    Vec_PtrForEachEntry( If_DecTab_t *, p->vTabs, pTab, i )
+        If_DecTabFree( pTab );
+    Vec_PtrFree( p->vTabs );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or creates the table with the given name.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static If_DecTab_t * If_DecCacheTable( If_DecCache_t * p, char * pName )
+{
+    If_DecTab_t * pTab; int i;
+    Vec_PtrForEachEntry( If_DecTab_t *, p->vTabs, pTab, i )
+        if ( !strcmp(pTab->pName, pName) )
+            return pTab;
+    pTab = If_DecTabAlloc( pName );
+    Vec_PtrPush( p->vTabs, pTab );
+    return pTab;
+}
+static int If_DecTabEntryNum( If_DecTab_t * p )
+{
+    int v, Count = 0;
+    for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+        Count += Vec_StrSize(p->vVerds[v]);
+    return Count;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Names the cut-function check used by the mapper.]
+
+  Description [The verdict of a check depends only on the truth table
+  of the cut, the check itself, the LUT structure, the LUT size, and
+  the flags the check reads (for example, If_CutPerformCheck75() takes
+  a faster path with -f unless -z is used). Returns 0 if the check is
+  not known to be a pure function of these.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_DecCacheKey( If_Man_t * p, char * pBuffer )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->pFuncCell == NULL || pPars->pFuncCell2 || pPars->fUseDsd || pPars->fUseTtPerm || !pPars->fTruth )
+        return 0;
+    if ( pPars->pFuncCell == If_CutPerformCheck16 && pPars->pLutStruct )
+        sprintf( pBuffer, "S%s", pPars->pLutStruct );
+    else if ( pPars->pFuncCell == If_CutPerformCheckXX && pPars->pLutStruct )
+        sprintf( pBuffer, "N%s", pPars->pLutStruct );
+    else if ( pPars->pFuncCell == If_CutPerformCheck07 )
+        sprintf( pBuffer, "C07" );
+    else if ( pPars->pFuncCell == If_CutPerformCheck75 )
+        sprintf( pBuffer, "C75%s%s%s", pPars->fEnableCheck75 ? "f" : "", pPars->fEnableCheck75u ? "u" : "", pPars->fDeriveLuts ? "z" : "" );
+    else if ( pPars->pFuncCell == If_MatchCheck1 )
+        sprintf( pBuffer, "M1" );
+    else if ( pPars->pFuncCell == If_MatchCheck2 )
+        sprintf( pBuffer, "M2" );
+    else
+        return 0;
+    sprintf( pBuffer + strlen(pBuffer), ":K%d", pPars->nLutSize );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Connects the mapper to the cache.]
+
+  Description [Leaves the mapper unchanged if its cut-function check
+  cannot be cached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_DecCacheAttach( If_Man_t * p, If_DecCache_t * pCache )
+{
+    char pName[100];
+    if ( pCache == NULL || !If_DecCacheKey(p, pName) )
+        return;
+    p->pIfDecCache = pCache;
+    p->pIfDecTab   = If_DecCacheTable( pCache, pName );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the cut function is not implementable.]
+
+  Description [Looks up the verdict for the truth table of the cut and
+  calls the user's check only when the truth table is seen for the
+  first time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_DecCacheCheck( If_Man_t * p, If_Cut_t * pCut )
+{
+    If_DecTab_t * pTab = (If_DecTab_t *)p->pIfDecTab;
+    Vec_Mem_t * vTtMem = pTab->vTtMem[pCut->nLeaves];
+    Vec_Str_t * vVerds = pTab->vVerds[pCut->nLeaves];
+    word * pTruth = If_CutTruthW( p, pCut );
+    int nEntries  = Vec_MemEntryNum( vTtMem );
+    int iEntry    = Vec_MemHashInsert( vTtMem, pTruth );
+    if ( iEntry < nEntries )
+    {
+        p->pIfDecCache->nHits++;
+        return Vec_StrEntry( vVerds, iEntry );
+    }
+    p->pIfDecCache->nMisses++;
+    assert( iEntry == Vec_StrSize(vVerds) );
+    Vec_StrPush( vVerds, (char)!p->pPars->pFuncCell( p, (unsigned *)pTruth, Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct ) );
+    return Vec_StrEntryLast( vVerds );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_DecCachePrint( If_DecCache_t * p )
+{
+    If_DecTab_t * pTab; int i, v;
+    printf( "Decomposition cache: Tables = %d.  Hits = %d.  Misses = %d.\n", Vec_PtrSize(p->vTabs), p->nHits, p->nMisses );
+    Vec_PtrForEachEntry( If_DecTab_t *, p->vTabs, pTab, i )
+    {
+        int nMem = 0;
+        for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+            nMem += (int)Vec_MemMemory(pTab->vTtMem[v]) + Vec_StrCap(pTab->vVerds[v]);
+        printf( "%-12s :  Functions = %8d.  ", pTab->pName, If_DecTabEntryNum(pTab) );
+        for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+            if ( Vec_StrSize(pTab->vVerds[v]) )
+                printf( "%d=%d ", v, Vec_StrSize(pTab->vVerds[v]) );
+        printf( " Memory = %.2f MB\n", 1.0 * nMem / (1<<20) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the verdicts of the second cache to the first one.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_DecCacheMerge( If_DecCache_t * p, If_DecCache_t * pNew )
+{
+    If_DecTab_t * pTabNew, * pTab;
+    word * pTruth;
+    int i, t, v;
+    Vec_PtrForEachEntry( If_DecTab_t *, pNew->vTabs, pTabNew, t )
+    {
+        pTab = If_DecCacheTable( p, pTabNew->pName );
+        for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+            Vec_MemForEachEntry( pTabNew->vTtMem[v], pTruth, i )
+            {
+                int nEntries = Vec_MemEntryNum( pTab->vTtMem[v] );
+                if ( Vec_MemHashInsert( pTab->vTtMem[v], pTruth ) == nEntries )
+                    Vec_StrPush( pTab->vVerds[v], Vec_StrEntry(pTabNew->vVerds[v], i) );
+            }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads verdicts from file and merges them into the cache.]
+
+  Description [The file lists, for each table, its name and, for each
+  support size, the number of entries followed by the truth tables and
+  the verdicts stored as flat arrays. Nothing is merged if the file
+  is malformed or truncated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_DecCacheLoad( If_DecCache_t * p, char * pFileName )
+{
+    If_DecCache_t * pNew;
+    If_DecTab_t * pTab;
+    char pBuffer[10], pName[100];
+    word pTruth[1 << (IF_MAX_FUNC_LUTSIZE - 6)];
+    char * pVerds = NULL;
+    int i, t, v, nTabs, nVars, nWords, nFileSize, Num, RetValue = 0;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Reading decomposition cache file \"%s\" has failed.\n", pFileName );
+        return 0;
+    }
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = ftell( pFile );
+    rewind( pFile );
+    if ( fread( pBuffer, 4, 1, pFile ) != 1 || strncmp(pBuffer, DEC_VERSION, strlen(DEC_VERSION)) )
+    {
+        printf( "Unrecognized format of file \"%s\".\n", pFileName );
+        fclose( pFile );
+        return 0;
+    }
+    // read into a separate cache, which is merged only if the whole file is valid
+    pNew = If_DecCacheAlloc();
+    if ( fread( &nTabs, 4, 1, pFile ) != 1 || nTabs < 0 || nTabs > nFileSize / 9 )
+        goto finish;
+    for ( t = 0; t < nTabs; t++ )
+    {
+        if ( fread( &Num, 4, 1, pFile ) != 1 || Num <= 0 || Num >= 100 || fread( pName, Num, 1, pFile ) != 1 )
+            goto finish;
+        pName[Num] = 0;
+        pTab = If_DecCacheTable( pNew, pName );
+        if ( fread( &nVars, 4, 1, pFile ) != 1 || nVars < 0 || nVars > IF_MAX_FUNC_LUTSIZE + 1 )
+            goto finish;
+        for ( v = 0; v < nVars; v++ )
+        {
+            // each entry takes one byte for the verdict and the words of the truth table
+            nWords = Abc_Truth6WordNum( v );
+            if ( fread( &Num, 4, 1, pFile ) != 1 || Num < 0 || Num > (nFileSize - (int)ftell(pFile)) / (1 + (int)sizeof(word) * nWords) )
+                goto finish;
+            if ( Num == 0 )
+                continue;
+            pVerds = ABC_ALLOC( char, Num );
+            if ( fread( pVerds, Num, 1, pFile ) != 1 )
+                goto finish;
+            for ( i = 0; i < Num; i++ )
+            {
+                int nEntries = Vec_MemEntryNum( pTab->vTtMem[v] );
+                if ( (pVerds[i] != 0 && pVerds[i] != 1) || fread( pTruth, sizeof(word) * nWords, 1, pFile ) != 1 )
+                    goto finish;
+                if ( Vec_MemHashInsert( pTab->vTtMem[v], pTruth ) == nEntries )
+                    Vec_StrPush( pTab->vVerds[v], pVerds[i] );
+            }
+            ABC_FREE( pVerds );
+        }
+    }
+    If_DecCacheMerge( p, pNew );
+    RetValue = 1;
+finish:
+    if ( !RetValue )
+        printf( "File \"%s\" is not a valid decomposition cache.\n", pFileName );
+    ABC_FREE( pVerds );
+    If_DecCacheFree( pNew );
+    fclose( pFile );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the cache into a file.]
+
+  Description [Writes into a temporary file, which then replaces the
+  original one, so that other processes reading the cache never see
+  a partially written file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_DecCacheSave( If_DecCache_t * p, char * pFileName )
+{
+    If_DecTab_t * pTab;
+    char * pFileTemp = NULL;
+    word * pTruth;
+    int i, t, v, Num;
+    FILE * pFile;
+    int fd = Util_SignalTmpFile( pFileName, ".tmp", &pFileTemp );
+    if ( fd == -1 )
+    {
+        printf( "Cannot create a temporary file for \"%s\".\n", pFileName );
+        return 0;
+    }
+#ifdef WIN32
+    _close( fd );
+#else
+    close( fd );
+#endif
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Writing decomposition cache file \"%s\" has failed.\n", pFileTemp );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    fwrite( DEC_VERSION, 4, 1, pFile );
+    Num = Vec_PtrSize(p->vTabs);
+    fwrite( &Num, 4, 1, pFile );
+    Vec_PtrForEachEntry( If_DecTab_t *, p->vTabs, pTab, t )
+    {
+        Num = strlen(pTab->pName);
+        fwrite( &Num, 4, 1, pFile );
+        fwrite( pTab->pName, Num, 1, pFile );
+        Num = IF_MAX_FUNC_LUTSIZE + 1;
+        fwrite( &Num, 4, 1, pFile );
+        for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+        {
+            Num = Vec_StrSize(pTab->vVerds[v]);
+            fwrite( &Num, 4, 1, pFile );
+            if ( Num == 0 )
+                continue;
+            fwrite( Vec_StrArray(pTab->vVerds[v]), Num, 1, pFile );
+            Vec_MemForEachEntry( pTab->vTtMem[v], pTruth, i )
+                fwrite( pTruth, sizeof(word) * Vec_MemEntrySize(pTab->vTtMem[v]), 1, pFile );
+        }
+    }
+    fclose( pFile );
+    if ( rename( pFileTemp, pFileName ) )
+    {
+        printf( "Renaming file \"%s\" into \"%s\" has failed.\n", pFileTemp, pFileName );
+        remove( pFileTemp );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    ABC_FREE( pFileTemp );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
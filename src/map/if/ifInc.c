@@ -0,0 +1,325 @@
+/**CFile****************************************************************
+
+  FileName    [ifInc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [Reusing the mapping of the unchanged nodes from the previous run.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: ifInc.c,v 1.00 2026/10/19 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "if.h"
+#include "misc/vec/vecHsh.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the result of the previous mapping run
+struct If_IncMan_t_
+{
+    int                nLutSize;      // the LUT size
+    int                fLutLib;       // the LUT library is used
+    If_LibLut_t        LutLib;        // the copy of the LUT library (without the name)
+    int                nObjs;         // the number of objects
+    Vec_Int_t *        vCiIds;        // the object IDs of the CIs
+    Vec_Flt_t *        vCiArrs;       // the arrival times of the CIs
+    Vec_Int_t *        vKeys;         // the fanin literals of the nodes (two per node)
+    Vec_Int_t *        vNodes;        // the object IDs of the nodes
+    Hsh_IntMan_t *     pHash;         // the hash table of the nodes
+    Vec_Int_t *        vCutStarts;    // the offsets of the best cuts in the storage
+    Vec_Int_t *        vCuts;         // the best cuts (the leaf count followed by the leaves)
+    Vec_Flt_t *        vArrs;         // the arrival times of the nodes
+};
+
+static inline void If_ManIncKey( int * pKey, int iFan0, int fCompl0, int iFan1, int fCompl1 )
+{
+    int Lit0 = Abc_Var2Lit( iFan0, fCompl0 ), Lit1 = Abc_Var2Lit( iFan1, fCompl1 );
+    pKey[0] = Abc_MinInt( Lit0, Lit1 );
+    pKey[1] = Abc_MaxInt( Lit0, Lit1 );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping can be reused by the next run.]
+
+  Description [The unchanged nodes keep their best cuts and arrival times,
+  which is only correct when the cut delay depends on the LUT library and
+  the arrival times of the leaves. The features that compute cut functions
+  or use their own delay models are only supported by the full mapping.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManIncIsApplicable( If_Man_t * p )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( p->pManTim || p->nChoices || pPars->fTruth || pPars->fPower || pPars->fLiftLeaves )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->nGateSize > 0 ||
+         pPars->fUserRecLib || pPars->fUserSesLib || pPars->fUserLutDec || pPars->fUserLut2D )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->pFuncCell || pPars->pFuncCell2 || pPars->nAndDelay || pPars->nAndArea )
+        return 0;
+    return 1;
+}
+int If_ManIncIsCompatible( If_Man_t * p, If_IncMan_t * pInc )
+{
+    If_LibLut_t * pLib = p->pPars->pLutLib;
+    if ( !If_ManIncIsApplicable(p) )
+        return 0;
+    if ( pInc->nLutSize != p->pPars->nLutSize || pInc->fLutLib != (pLib != NULL) || Vec_IntSize(pInc->vCiIds) != If_ManCiNum(p) )
+        return 0;
+    if ( pLib == NULL )
+        return 1;
+    return pInc->LutLib.LutMax == pLib->LutMax && pInc->LutLib.fVarPinDelays == pLib->fVarPinDelays &&
+        !memcmp( pInc->LutLib.pLutAreas, pLib->pLutAreas, sizeof(pLib->pLutAreas) ) &&
+        !memcmp( pInc->LutLib.pLutDelays, pLib->pLutDelays, sizeof(pLib->pLutDelays) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the result of mapping for the next run.]
+
+  Description [The nodes are hashed by their fanin literals, so that the
+  nodes of the next network can be matched structurally. For each node,
+  the best cut and its arrival time are recorded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_IncMan_t * If_ManIncDerive( If_Man_t * p )
+{
+    If_IncMan_t * pInc;
+    If_Obj_t * pObj;
+    If_Cut_t * pCut;
+    int i, k, Key[2];
+    if ( !If_ManIncIsApplicable(p) )
+        return NULL;
+    pInc = ABC_CALLOC( If_IncMan_t, 1 );
+    pInc->nLutSize = p->pPars->nLutSize;
+    pInc->fLutLib  = (p->pPars->pLutLib != NULL);
+    if ( pInc->fLutLib )
+    {
+        pInc->LutLib = *p->pPars->pLutLib;
+        pInc->LutLib.pName = NULL;
+    }
+    pInc->nObjs      = If_ManObjNum(p);
+    pInc->vCiIds     = Vec_IntAlloc( If_ManCiNum(p) );
+    pInc->vCiArrs    = Vec_FltAlloc( If_ManCiNum(p) );
+    pInc->vKeys      = Vec_IntAlloc( 2 * If_ManAndNum(p) );
+    pInc->vNodes     = Vec_IntAlloc( If_ManAndNum(p) );
+    pInc->vCutStarts = Vec_IntStartFull( If_ManObjNum(p) );
+    pInc->vCuts      = Vec_IntAlloc( 4 * If_ManAndNum(p) );
+    pInc->vArrs      = Vec_FltStart( If_ManObjNum(p) );
+    If_ManForEachCi( p, pObj, i )
+    {
+        Vec_IntPush( pInc->vCiIds, pObj->Id );
+        Vec_FltPush( pInc->vCiArrs, If_ObjArrTime(pObj) );
+    }
+    If_ManForEachNode( p, pObj, i )
+    {
+        If_ManIncKey( Key, If_ObjFanin0(pObj)->Id, pObj->fCompl0, If_ObjFanin1(pObj)->Id, pObj->fCompl1 );
+        Vec_IntPushTwo( pInc->vKeys, Key[0], Key[1] );
+        Vec_IntPush( pInc->vNodes, pObj->Id );
+        pCut = If_ObjCutBest(pObj);
+        Vec_IntWriteEntry( pInc->vCutStarts, pObj->Id, Vec_IntSize(pInc->vCuts) );
+        Vec_IntPush( pInc->vCuts, If_CutLeaveNum(pCut) );
+        for ( k = 0; k < If_CutLeaveNum(pCut); k++ )
+            Vec_IntPush( pInc->vCuts, pCut->pLeaves[k] );
+        Vec_FltWriteEntry( pInc->vArrs, pObj->Id, If_ObjArrTime(pObj) );
+    }
+    pInc->pHash = Hsh_IntManStart( pInc->vKeys, 2, Vec_IntSize(pInc->vNodes) );
+    for ( i = 0; i < Vec_IntSize(pInc->vNodes); i++ )
+        Hsh_IntManAdd( pInc->pHash, i );
+    return pInc;
+}
+void If_ManIncFree( If_IncMan_t * p )
+{
+    if ( p == NULL )
+        return;
+    Hsh_IntManStop( p->pHash );
+    Vec_IntFree( p->vCiIds );
+    Vec_FltFree( p->vCiArrs );
+    Vec_IntFree( p->vKeys );
+    Vec_IntFree( p->vNodes );
+    Vec_IntFree( p->vCutStarts );
+    Vec_IntFree( p->vCuts );
+    Vec_FltFree( p->vArrs );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the best cut of the node from the previous run.]
+
+  Description [Returns 0 if some leaf of the cut has changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManIncTransferCut( If_Man_t * p, If_IncMan_t * pInc, If_Obj_t * pObj, int iOld, Vec_Int_t * vOld2New )
+{
+    If_Cut_t * pCut = If_ObjCutBest(pObj);
+    int * pCutOld = Vec_IntEntryP( pInc->vCuts, Vec_IntEntry(pInc->vCutStarts, iOld) );
+    int k, m, iNew;
+    assert( pCutOld[0] <= p->pPars->nLutSize );
+    for ( k = 0; k < pCutOld[0]; k++ )
+    {
+        iNew = Vec_IntEntry( vOld2New, pCutOld[1+k] );
+        if ( iNew == -1 || iNew >= pObj->Id )
+            return 0;
+        // the leaf should keep its own mapping
+        if ( If_ObjIsAnd(If_ManObj(p, iNew)) && !Vec_BitEntry(p->vFrozen, iNew) )
+            return 0;
+        // the leaves are sorted by the new IDs
+        for ( m = k; m > 0 && pCut->pLeaves[m-1] > iNew; m-- )
+            pCut->pLeaves[m] = pCut->pLeaves[m-1];
+        pCut->pLeaves[m] = iNew;
+    }
+    pCut->nLeaves   = pCutOld[0];
+    pCut->nLimit    = p->pPars->nLutSize;
+    pCut->uSign     = If_ObjCutSignCompute( pCut );
+    pCut->iCutFunc  = -1;
+    pCut->uMaskFunc = 0;
+    pCut->fCompl    = 0;
+    pCut->fUser     = 0;
+    pCut->fUseless  = 0;
+    pCut->fAndCut   = 0;
+    pCut->Cost      = 0;
+    pCut->Area      = 0;
+    pCut->Edge      = 0;
+    pCut->Power     = 0;
+    pCut->Delay     = Vec_FltEntry( pInc->vArrs, iOld );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Matches the nodes with the previous run.]
+
+  Description [A node is unchanged if it has the same fanins as a node of
+  the previous network, which means that its fanin cone is unchanged too.
+  The unchanged nodes whose best cuts can be transferred are marked frozen:
+  their cuts are not enumerated, their arrival times are not recomputed,
+  and area recovery does not touch them. Only the nodes in the transitive
+  fanout of the changed nodes are mapped. Returns the number of frozen nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManIncAttach( If_Man_t * p, If_IncMan_t * pInc )
+{
+    Vec_Int_t * vNew2Old, * vOld2New;
+    If_Obj_t * pObj;
+    int i, iOld, iOld0, iOld1, Key[2], * pPlace, nFrozen = 0;
+    assert( p->vFrozen == NULL );
+    if ( pInc == NULL || !If_ManIncIsCompatible(p, pInc) )
+        return 0;
+    vNew2Old = Vec_IntStartFull( If_ManObjNum(p) );
+    vOld2New = Vec_IntStartFull( pInc->nObjs );
+    Vec_IntWriteEntry( vNew2Old, p->pConst1->Id, 0 );
+    Vec_IntWriteEntry( vOld2New, 0, p->pConst1->Id );
+    If_ManForEachCi( p, pObj, i )
+    {
+        // the CI with a different arrival time is treated as changed
+        if ( (p->pPars->pTimesArr ? p->pPars->pTimesArr[i] : (float)0.0) != Vec_FltEntry(pInc->vCiArrs, i) )
+            continue;
+        iOld = Vec_IntEntry( pInc->vCiIds, i );
+        Vec_IntWriteEntry( vNew2Old, pObj->Id, iOld );
+        Vec_IntWriteEntry( vOld2New, iOld, pObj->Id );
+    }
+    p->vFrozen = Vec_BitStart( If_ManObjNum(p) );
+    If_ManForEachNode( p, pObj, i )
+    {
+        iOld0 = Vec_IntEntry( vNew2Old, If_ObjFanin0(pObj)->Id );
+        iOld1 = Vec_IntEntry( vNew2Old, If_ObjFanin1(pObj)->Id );
+        if ( iOld0 == -1 || iOld1 == -1 )
+            continue;
+        If_ManIncKey( Key, iOld0, pObj->fCompl0, iOld1, pObj->fCompl1 );
+        pPlace = Hsh_IntManLookup( pInc->pHash, (unsigned *)Key );
+        if ( *pPlace == -1 )
+            continue;
+        iOld = Vec_IntEntry( pInc->vNodes, Hsh_IntObj(pInc->pHash, *pPlace)->iData );
+        Vec_IntWriteEntry( vNew2Old, pObj->Id, iOld );
+        if ( Vec_IntEntry(vOld2New, iOld) == -1 )
+            Vec_IntWriteEntry( vOld2New, iOld, pObj->Id );
+        if ( !If_ManIncTransferCut(p, pInc, pObj, iOld, vOld2New) )
+            continue;
+        Vec_BitWriteEntry( p->vFrozen, pObj->Id, 1 );
+        nFrozen++;
+    }
+    Vec_IntFree( vNew2Old );
+    Vec_IntFree( vOld2New );
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Incremental mapping: Reusing the mapping of %d (%.2f %%) out of %d nodes.\n",
+            nFrozen, 100.0 * nFrozen / Abc_MaxInt(1, If_ManAndNum(p)), If_ManAndNum(p) );
+    return nFrozen;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping step for the frozen node.]
+
+  Description [The best cut and its delay stay the same. The cutset contains
+  the best cut and the trivial cut, which is enough for the changed fanouts
+  to see the current mapping of the node. The area flow is updated because
+  it depends on the references of the leaves.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ObjPerformMappingFrozen( If_Man_t * p, If_Obj_t * pObj, int Mode )
+{
+    If_Set_t * pCutSet;
+    If_Cut_t * pCut = If_ObjCutBest(pObj);
+    assert( If_ObjIsFrozen(p, pObj) );
+    if ( Mode == 0 )
+        pObj->EstRefs = (float)pObj->nRefs;
+    else if ( Mode == 1 )
+        pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
+    if ( Mode < 2 )
+    {
+        pCut->Area = If_CutAreaFlow( p, pCut );
+        if ( p->pPars->fEdge )
+            pCut->Edge = If_CutEdgeFlow( p, pCut );
+    }
+    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    If_CutCopy( p, pCutSet->ppCuts[pCutSet->nCuts++], pCut );
+    if ( !pObj->fSkipCut && pCut->nLeaves > 1 )
+        If_ManSetupCutTriv( p, pCutSet->ppCuts[pCutSet->nCuts++], pObj->Id );
+    If_ManDerefNodeCutSet( p, pObj );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -29,8 +29,10 @@ ABC_NAMESPACE_IMPL_START
 
 static If_Obj_t * If_ManSetupObj( If_Man_t * p );
 
+static void       If_ManSetupSetMore( If_Man_t * p, int nCutSets );
+
 static void       If_ManCutSetRecycle( If_Man_t * p, If_Set_t * pSet ) { pSet->pNext = p->pFreeList; p->pFreeList = pSet;                            }
-static If_Set_t * If_ManCutSetFetch( If_Man_t * p )                    { If_Set_t * pTemp = p->pFreeList; p->pFreeList = p->pFreeList->pNext; return pTemp; }
+static If_Set_t * If_ManCutSetFetch( If_Man_t * p )                    { If_Set_t * pTemp; if ( p->pFreeList == NULL ) If_ManSetupSetMore( p, 1024 ); pTemp = p->pFreeList; p->pFreeList = p->pFreeList->pNext; return pTemp; }
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -223,6 +225,8 @@ void If_ManStop( If_Man_t * p )
         for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
             nMemTotal += (int)Vec_MemMemory(p->vTtMem[i]);
         printf( "Unique truth tables = %d   Memory = %.2f MB   ", nUnique, 1.0 * nMemTotal / (1<<20) ); 
+        if ( p->timeCache[4] )
+            printf( "Rate = %.2f Mcuts/sec   ", 1.0e-6 * p->nCutsTruth * CLOCKS_PER_SEC / p->timeCache[4] ); 
         Abc_PrintTime( 1, "Time", p->timeCache[4] );
         if ( p->nCacheMisses )
         {
@@ -243,11 +247,14 @@ void If_ManStop( If_Man_t * p )
     }
 //    if ( p->pPars->fVerbose && p->nCuts5 )
 //        Abc_Print( 1, "Statistics about 5-cuts: Total = %d  Non-decomposable = %d (%.2f %%)\n", p->nCuts5, p->nCuts5-p->nCuts5a, 100.0*(p->nCuts5-p->nCuts5a)/p->nCuts5 );
+    if ( p->pPars->fVerbose && p->pIfDecCache )
+        If_DecCachePrint( p->pIfDecCache );
     if ( p->pIfDsdMan )
         p->pIfDsdMan = NULL;
     if ( p->pPars->fUseDsd && (p->nCountNonDec[0] || p->nCountNonDec[1]) )
         printf( "NonDec0 = %d.  NonDec1 = %d.\n", p->nCountNonDec[0], p->nCountNonDec[1] );
     Vec_IntFreeP( &p->vCoAttrs );
+    Vec_BitFreeP( &p->vFrozen );
     Vec_PtrFree( p->vCis );
     Vec_PtrFree( p->vCos );
     Vec_PtrFree( p->vObjs );
@@ -293,6 +300,8 @@ void If_ManStop( If_Man_t * p )
     }
     ABC_FREE( p->pMemCi );
     ABC_FREE( p->pMemAnd );
+    if ( p->vMemAnds )
+        Vec_PtrFreeFree( p->vMemAnds );
     ABC_FREE( p->puTemp[0] );
     ABC_FREE( p->puTempW );
     // free pars memory
@@ -718,6 +727,36 @@ void If_ManSetupSetAll( If_Man_t * p, int nCrossCut )
 
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds more cutsets to the free list.]
+
+  Description [The cutsets allocated by If_ManSetupSetAll() are enough 
+  when the nodes are mapped in the topological order. Other orders, such 
+  as the level order used by the concurrent mapper, may need more.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManSetupSetMore( If_Man_t * p, int nCutSets )
+{
+    If_Set_t * pCutSet;
+    int i;
+    assert( p->pFreeList == NULL );
+    if ( p->vMemAnds == NULL )
+        p->vMemAnds = Vec_PtrAlloc( 100 );
+    pCutSet = (If_Set_t *)ABC_ALLOC( char, nCutSets * p->nSetBytes );
+    Vec_PtrPush( p->vMemAnds, pCutSet );
+    for ( i = 0; i < nCutSets; i++ )
+    {
+        If_ManSetupSet( p, pCutSet );
+        If_ManCutSetRecycle( p, pCutSet );
+        pCutSet = (If_Set_t *)( (char *)pCutSet + p->nSetBytes );
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
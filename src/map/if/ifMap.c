@@ -171,18 +171,24 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
     assert( !If_ObjIsAnd(pObj->pFanin0) || pObj->pFanin0->pCutSet->nCuts > 0 );
     assert( !If_ObjIsAnd(pObj->pFanin1) || pObj->pFanin1->pCutSet->nCuts > 0 );
+    // the node is unchanged since the previous run (incremental mapping)
+    if ( If_ObjIsFrozen(p, pObj) )
+    {
+        If_ObjPerformMappingFrozen( p, pObj, Mode );
+        return;
+    }
 
     // prepare
     if ( Mode == 0 )
         pObj->EstRefs = (float)pObj->nRefs;
     else if ( Mode == 1 )
         pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
-    // deref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    // deref the selected cut (the concurrent mapper does it before calling this)
+    if ( Mode && pObj->nRefs > 0 && !p->pPthMan )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
     // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    pCutSet = p->pPthMan ? pObj->pCutSet : If_ManSetupNodeCutSet( p, pObj );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -295,7 +301,10 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             else
                 fChange = If_CutComputeTruth( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1 );
             if ( p->pPars->fVerbose )
+            {
                 p->timeCache[4] += Abc_Clock() - clk;
+                p->nCutsTruth++;
+            }
             if ( !p->pPars->fSkipCutFilter && fChange && If_CutFilter( pCutSet, pCut, fSave0 ) )
                 continue;
             if ( p->pPars->fLut6Filter && pCut->nLeaves == 6 && !If_CutCheckTruth6(p, pCut) )
@@ -328,6 +337,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                     pCut->fUseless = If_DsdManCheckDec( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
                 else if ( p->pPars->pFuncCell2 )
                     pCut->fUseless = !p->pPars->pFuncCell2( p, (word *)If_CutTruthW(p, pCut), pCut->nLeaves, NULL, NULL );
+                else if ( p->pIfDecTab )
+                    pCut->fUseless = If_DecCacheCheck( p, pCut );
                 else
                     pCut->fUseless = !p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct );
                 p->nCutsUselessAll += pCut->fUseless;
@@ -494,8 +505,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //    else if ( If_ObjCutBest(pObj)->nLeaves == 1 )
 //        p->nBestCutSmall[1]++;
 
-    // ref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    // ref the selected cut (the concurrent mapper does it after calling this)
+    if ( Mode && pObj->nRefs > 0 && !p->pPthMan )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
     if ( If_ObjCutBest(pObj)->fUseless )
         Abc_Print( 1, "The best cut is useless.\n" );
@@ -504,7 +515,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
     // free the cuts
-    If_ManDerefNodeCutSet( p, pObj );
+    if ( !p->pPthMan )
+        If_ManDerefNodeCutSet( p, pObj );
 }
 
 /**Function*************************************************************
@@ -658,6 +670,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( If_ManPthIsApplicable(p, Mode) )
+        If_ManPthPerformMappingRound( p, Mode, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
@@ -0,0 +1,332 @@
+/**CFile****************************************************************
+
+  FileName    [ifPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [Concurrent mapping of the nodes of one logic level.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: ifPth.c,v 1.00 2026/10/19 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "if.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int  If_ManPthIsApplicable( If_Man_t * p, int Mode )                                { return 0;                                            }
+void If_ManPthPerformMappingRound( If_Man_t * p, int Mode, int fPreprocess, int fFirst ) { assert( 0 );                                    }
+int  If_ManPthTtInsert( If_Man_t * p, int nLeaves, word * pTruth )                  { return Vec_MemHashInsert( p->vTtMem[nLeaves], pTruth ); }
+
+#else // pthreads are used
+
+#define IF_PTH_CHUNK       64   // the number of nodes taken by a worker at a time
+#define IF_PTH_LEVEL_MIN  256   // smaller levels are mapped by one thread
+
+typedef struct If_PthMan_t_ If_PthMan_t;
+struct If_PthMan_t_
+{
+    If_Man_t *       pMan;        // the mapping manager
+    int              nWorkers;    // the number of workers
+    If_Man_t **      pWorkers;    // the copies of the manager used by the workers
+    pthread_mutex_t  pMutexes[IF_MAX_FUNC_LUTSIZE+1]; // locks of the truth table shards
+    Vec_Int_t *      vLevel;      // the nodes of the current level
+    atomic_int       iNext;       // the next node of the level to be mapped
+    int              Mode;        // the mapping mode
+    int              fPreprocess; // the preprocessing flag
+    int              fFirst;      // the first round flag
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping round can be done concurrently.]
+
+  Description [Exact area recovery and the features that keep their own
+  data in the manager (DSD, truth table permutations, user callbacks,
+  timing boxes, choices, incremental mapping, etc) are only supported by the sequential code.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPthIsApplicable( If_Man_t * p, int Mode )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->nThreads < 2 || Mode == 2 )
+        return 0;
+    if ( p->pManTim || p->nChoices || p->vFrozen || pPars->fLiftLeaves || pPars->fPower )
+        return 0;
+    if ( pPars->pLutLib && pPars->pLutLib->fVarPinDelays )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->nGateSize > 0 ||
+         pPars->fUserRecLib || pPars->fUserSesLib || pPars->fUserLutDec || pPars->fUserLut2D )
+        return 0;
+    if ( pPars->fUseDsd || pPars->fUseDsdTune || pPars->fUseTtPerm || pPars->fUseCofVars || pPars->fUseAndVars ||
+         pPars->fUse34Spec || pPars->fUseBat || pPars->fUseCheck1 || pPars->fUseCheck2 || pPars->fEnableCheck75 || pPars->fEnableCheck75u )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->pFuncCell || pPars->pFuncCell2 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the truth table to the shared table.]
+
+  Description [Called by the workers. The truth tables of different sizes
+  are kept in different tables (shards), each protected by its own lock.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPthTtInsert( If_Man_t * p, int nLeaves, word * pTruth )
+{
+    If_PthMan_t * pPth = (If_PthMan_t *)p->pPthMan;
+    int iShard = Abc_MaxInt( 6, nLeaves ), truthId, status;
+    status = pthread_mutex_lock( pPth->pMutexes + iShard );  assert( status == 0 );
+    truthId = Vec_MemHashInsert( p->vTtMem[nLeaves], pTruth );
+    status = pthread_mutex_unlock( pPth->pMutexes + iShard );  assert( status == 0 );
+    return truthId;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the concurrent mapping manager.]
+
+  Description [Each worker gets a copy of the manager with its own room
+  for temporary truth tables and its own statistics. The copies share
+  the nodes, the parameters, and the truth table tables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_PthMan_t * If_ManPthStart( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    If_PthMan_t * pPth;
+    If_Man_t * pW;
+    int w, i, status, nWords = p->nTruth6Words[p->pPars->nLutSize];
+    pPth = ABC_CALLOC( If_PthMan_t, 1 );
+    pPth->pMan        = p;
+    pPth->nWorkers    = p->pPars->nThreads;
+    pPth->pWorkers    = ABC_CALLOC( If_Man_t *, pPth->nWorkers );
+    pPth->Mode        = Mode;
+    pPth->fPreprocess = fPreprocess;
+    pPth->fFirst      = fFirst;
+    for ( i = 0; i <= IF_MAX_FUNC_LUTSIZE; i++ )
+    {
+        status = pthread_mutex_init( pPth->pMutexes + i, NULL );  assert( status == 0 );
+    }
+    for ( w = 0; w < pPth->nWorkers; w++ )
+    {
+        pW = pPth->pWorkers[w] = ABC_ALLOC( If_Man_t, 1 );
+        memcpy( pW, p, sizeof(If_Man_t) );
+        pW->pPthMan     = pPth;
+        pW->nCutsMerged = 0;
+        pW->nCutsTotal  = 0;
+        pW->nCutsTruth  = 0;
+        pW->nCutsUselessAll = 0;
+        pW->nCutsCountAll   = 0;
+        pW->nCacheHits      = 0;
+        pW->nCacheMisses    = 0;
+        memset( pW->nCutsUseless, 0, sizeof(int) * 32 );
+        memset( pW->nCutsCount,   0, sizeof(int) * 32 );
+        memset( pW->timeCache,    0, sizeof(abctime) * 6 );
+        pW->vVisited    = Vec_PtrAlloc( 100 );
+        pW->puTemp[0]   = p->pPars->fTruth? ABC_ALLOC( unsigned, 8 * nWords ) : NULL;
+        pW->puTemp[1]   = p->pPars->fTruth? pW->puTemp[0] + nWords*2 : NULL;
+        pW->puTemp[2]   = p->pPars->fTruth? pW->puTemp[1] + nWords*2 : NULL;
+        pW->puTemp[3]   = p->pPars->fTruth? pW->puTemp[2] + nWords*2 : NULL;
+        pW->puTempW     = p->pPars->fTruth? ABC_ALLOC( word, nWords ) : NULL;
+    }
+    return pPth;
+}
+void If_ManPthStop( If_PthMan_t * pPth )
+{
+    If_Man_t * p = pPth->pMan, * pW;
+    int w, i, status;
+    for ( w = 0; w < pPth->nWorkers; w++ )
+    {
+        pW = pPth->pWorkers[w];
+        p->nCutsMerged  += pW->nCutsMerged;
+        p->nCutsTotal   += pW->nCutsTotal;
+        p->nCutsTruth   += pW->nCutsTruth;
+        p->nCutsUselessAll += pW->nCutsUselessAll;
+        p->nCutsCountAll   += pW->nCutsCountAll;
+        p->nCacheHits      += pW->nCacheHits;
+        p->nCacheMisses    += pW->nCacheMisses;
+        for ( i = 0; i < 32; i++ )
+        {
+            p->nCutsUseless[i] += pW->nCutsUseless[i];
+            p->nCutsCount[i]   += pW->nCutsCount[i];
+        }
+        for ( i = 0; i < 6; i++ )
+            p->timeCache[i] += pW->timeCache[i];
+        Vec_PtrFree( pW->vVisited );
+        ABC_FREE( pW->puTemp[0] );
+        ABC_FREE( pW->puTempW );
+        ABC_FREE( pW );
+    }
+    for ( i = 0; i <= IF_MAX_FUNC_LUTSIZE; i++ )
+    {
+        status = pthread_mutex_destroy( pPth->pMutexes + i );  assert( status == 0 );
+    }
+    ABC_FREE( pPth->pWorkers );
+    ABC_FREE( pPth );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the nodes of the current level.]
+
+  Description [The workers take the nodes of the level in chunks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * If_ManPthWorkerThread( void * pArg )
+{
+    If_Man_t * pW = (If_Man_t *)pArg;
+    If_PthMan_t * pPth = (If_PthMan_t *)pW->pPthMan;
+    int i, iStart, nNodes = Vec_IntSize(pPth->vLevel);
+    while ( (iStart = atomic_fetch_add( &pPth->iNext, IF_PTH_CHUNK )) < nNodes )
+        for ( i = iStart; i < Abc_MinInt(iStart + IF_PTH_CHUNK, nNodes); i++ )
+            If_ObjPerformMappingAnd( pW, If_ManObj(pW, Vec_IntEntry(pPth->vLevel, i)), pPth->Mode, pPth->fPreprocess, pPth->fFirst );
+    return NULL;
+}
+void If_ManPthMapLevel( If_PthMan_t * pPth, Vec_Int_t * vLevel )
+{
+    pthread_t * pThreads;
+    int w, status;
+    pPth->vLevel = vLevel;
+    atomic_store( &pPth->iNext, 0 );
+    if ( Vec_IntSize(vLevel) < IF_PTH_LEVEL_MIN )
+    {
+        If_ManPthWorkerThread( pPth->pWorkers[0] );
+        return;
+    }
+    // the calling thread is the first worker
+    pThreads = ABC_ALLOC( pthread_t, pPth->nWorkers );
+    for ( w = 1; w < pPth->nWorkers; w++ )
+    {
+        status = pthread_create( pThreads + w, NULL, If_ManPthWorkerThread, (void *)pPth->pWorkers[w] );  assert( status == 0 );
+    }
+    If_ManPthWorkerThread( pPth->pWorkers[0] );
+    for ( w = 1; w < pPth->nWorkers; w++ )
+    {
+        status = pthread_join( pThreads[w], NULL );  assert( status == 0 );
+    }
+    ABC_FREE( pThreads );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass over all nodes by levels.]
+
+  Description [The nodes of one level do not depend on each other and
+  are mapped concurrently. Everything that touches other nodes is done
+  by the calling thread before and after each level: it takes the cutsets
+  from the free list, dereferences the old best cuts in the area flow mode,
+  references the new ones, and recycles the cutsets of the fanins. Thus,
+  the area flow of the nodes of one level is computed using the references
+  as they were before the level, which makes the result independent of the
+  number of threads. The delay mode gives the same result as the sequential
+  code.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPthPerformMappingRound( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    If_PthMan_t * pPth;
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj;
+    int i, k, v, nCutPairs = (p->pPars->nCutsMax + 1) * (p->pPars->nCutsMax + 1);
+    assert( If_ManPthIsApplicable(p, Mode) );
+    // collect the nodes by level
+    vLevels = Vec_WecAlloc( 100 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_WecPush( vLevels, pObj->Level, pObj->Id );
+    pPth = If_ManPthStart( p, Mode, fPreprocess, fFirst );
+    Vec_WecForEachLevel( vLevels, vLevel, k )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        Vec_IntForEachEntry( vLevel, i, v )
+        {
+            pObj = If_ManObj( p, i );
+            if ( Mode && pObj->nRefs > 0 )
+                If_CutAreaDeref( p, If_ObjCutBest(pObj) );
+            If_ManSetupNodeCutSet( p, pObj );
+        }
+        // make sure the truth tables are not moved while the level is mapped
+        if ( p->pPars->fTruth )
+            for ( v = 6; v <= Abc_MaxInt(6, p->pPars->nLutSize); v++ )
+                Vec_MemReserve( p->vTtMem[v], Vec_MemEntryNum(p->vTtMem[v]) + Vec_IntSize(vLevel) * nCutPairs );
+        If_ManPthMapLevel( pPth, vLevel );
+        Vec_IntForEachEntry( vLevel, i, v )
+        {
+            pObj = If_ManObj( p, i );
+            if ( Mode && pObj->nRefs > 0 )
+                If_CutAreaRef( p, If_ObjCutBest(pObj) );
+            If_ManDerefNodeCutSet( p, pObj );
+        }
+    }
+    If_ManPthStop( pPth );
+    Vec_WecFree( vLevels );
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
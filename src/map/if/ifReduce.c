@@ -87,7 +87,8 @@ void If_ManImproveExpand( If_Man_t * p, int nLimit )
     vVisited  = Vec_PtrAlloc( 100 );
     // iterate through all nodes in the topological order
     If_ManForEachNode( p, pObj, i )
-        If_ManImproveNodeExpand( p, pObj, nLimit, vFront, vFrontOld, vVisited );
+        if ( !If_ObjIsFrozen(p, pObj) )
+            If_ManImproveNodeExpand( p, pObj, nLimit, vFront, vFrontOld, vVisited );
     Vec_PtrFree( vFront );
     Vec_PtrFree( vFrontOld );
     Vec_PtrFree( vVisited );
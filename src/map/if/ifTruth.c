@@ -104,17 +104,34 @@ int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_
     word * pTruth0  = (word *)p->puTemp[0];
     word * pTruth1  = (word *)p->puTemp[1];
     word * pTruth   = (word *)p->puTemp[2];
-    Abc_TtCopy( pTruth0, pTruth0s, p->nTruth6Words[pCut0->nLeaves], fCompl0 ^ pCut0->fCompl ^ Abc_LitIsCompl(pCut0->iCutFunc) );
-    Abc_TtCopy( pTruth1, pTruth1s, p->nTruth6Words[pCut1->nLeaves], fCompl1 ^ pCut1->fCompl ^ Abc_LitIsCompl(pCut1->iCutFunc) );
-    Abc_TtStretch6( pTruth0, pCut0->nLeaves, pCut->nLeaves );
-    Abc_TtStretch6( pTruth1, pCut1->nLeaves, pCut->nLeaves );
-    Abc_TtExpand( pTruth0, pCut->nLeaves, pCut0->pLeaves, pCut0->nLeaves, pCut->pLeaves, pCut->nLeaves );
-    Abc_TtExpand( pTruth1, pCut->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, pCut->nLeaves );
-    fCompl         = (pTruth0[0] & pTruth1[0] & 1);
-    Abc_TtAnd( pTruth, pTruth0, pTruth1, p->nTruth6Words[pCut->nLeaves], fCompl );
+    if ( pCut->nLeaves <= 6 )
+    {
+        // single-word truth tables do not need stretching and use word-level variable swaps
+        word t0 = pTruth0s[0], t1 = pTruth1s[0];
+        if ( fCompl0 ^ pCut0->fCompl ^ Abc_LitIsCompl(pCut0->iCutFunc) ) t0 = ~t0;
+        if ( fCompl1 ^ pCut1->fCompl ^ Abc_LitIsCompl(pCut1->iCutFunc) ) t1 = ~t1;
+        t0 = Abc_Tt6Expand( t0, pCut0->pLeaves, pCut0->nLeaves, pCut->pLeaves, pCut->nLeaves );
+        t1 = Abc_Tt6Expand( t1, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, pCut->nLeaves );
+        fCompl    = (int)(t0 & t1 & 1);
+        pTruth[0] = fCompl ? ~(t0 & t1) : t0 & t1;
+    }
+    else
+    {
+        Abc_TtCopy( pTruth0, pTruth0s, p->nTruth6Words[pCut0->nLeaves], fCompl0 ^ pCut0->fCompl ^ Abc_LitIsCompl(pCut0->iCutFunc) );
+        Abc_TtCopy( pTruth1, pTruth1s, p->nTruth6Words[pCut1->nLeaves], fCompl1 ^ pCut1->fCompl ^ Abc_LitIsCompl(pCut1->iCutFunc) );
+        Abc_TtStretch6( pTruth0, pCut0->nLeaves, pCut->nLeaves );
+        Abc_TtStretch6( pTruth1, pCut1->nLeaves, pCut->nLeaves );
+        Abc_TtExpand( pTruth0, pCut->nLeaves, pCut0->pLeaves, pCut0->nLeaves, pCut->pLeaves, pCut->nLeaves );
+        Abc_TtExpand( pTruth1, pCut->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, pCut->nLeaves );
+        fCompl    = (pTruth0[0] & pTruth1[0] & 1);
+        Abc_TtAnd( pTruth, pTruth0, pTruth1, p->nTruth6Words[pCut->nLeaves], fCompl );
+    }
     if ( p->pPars->fCutMin && (pCut0->nLeaves + pCut1->nLeaves > pCut->nLeaves || pCut0->nLeaves == 0 || pCut1->nLeaves == 0) )
     {
-        nLeavesNew = Abc_TtMinBase( pTruth, pCut->pLeaves, pCut->nLeaves, pCut->nLeaves );
+        if ( pCut->nLeaves <= 6 )
+            nLeavesNew = Abc_Tt6MinBase( pTruth, pCut->pLeaves, pCut->nLeaves );
+        else
+            nLeavesNew = Abc_TtMinBase( pTruth, pCut->pLeaves, pCut->nLeaves, pCut->nLeaves );
         if ( nLeavesNew < If_CutLeaveNum(pCut) )
         {
             pCut->nLeaves = nLeavesNew;
@@ -123,7 +140,7 @@ int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_
         }
     }
     PrevSize       = Vec_MemEntryNum( p->vTtMem[pCut->nLeaves] );   
-    truthId        = Vec_MemHashInsert( p->vTtMem[pCut->nLeaves], pTruth );
+    truthId        = p->pPthMan ? If_ManPthTtInsert( p, pCut->nLeaves, pTruth ) : Vec_MemHashInsert( p->vTtMem[pCut->nLeaves], pTruth );
     pCut->iCutFunc = Abc_Var2Lit( truthId, fCompl );
     assert( (pTruth[0] & 1) == 0 );
 #ifdef IF_TRY_NEW
@@ -297,7 +297,7 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
             clk = Abc_Clock();
             if ( Vec_IntSize(p->vChanged) )
-                Abc_SclTimeIncUpdate( p );
+                Abc_SclTimeIncUpdate( p, 1 );
             else
                 Abc_SclTimeNtkRecompute( p, &p->SumArea, &p->MaxDelay, pPars->fUseDept, pPars->DelayUser );
             p->timeTime += Abc_Clock() - clk;
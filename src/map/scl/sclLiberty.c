@@ -21,14 +21,37 @@
 #ifdef _WIN32
 #include <shlwapi.h>
 #pragma comment(lib, "shlwapi.lib")
+#include <process.h>
 #else 
 #include <fnmatch.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 #include "sclLib.h"
 #include "misc/st/st.h"
 #include "map/mio/mio.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -80,6 +103,18 @@ struct Scl_Tree_t_
     Vec_Str_t *     vBuffer;      // temp string buffer
 };
 
+#define SCL_CHUNK_MIN      (1 << 20)  // the smallest part of the file parsed by one thread
+#define SCL_CHUNK_PER_PROC 4          // the number of parts per thread used for load balancing
+
+typedef struct Scl_Chunk_t_ Scl_Chunk_t;
+struct Scl_Chunk_t_
+{
+    char *          pBeg;         // the beginning of the part
+    char *          pEnd;         // the end of the part
+    Scl_Tree_t      Tree;         // the items of the part (sharing contents with the main tree)
+    long            iFirst;       // the first top-level item of the part
+};
+
 
 static inline int          Scl_LibertyGlobMatch(const char * pattern, const char * string) {
     #ifdef _WIN32
@@ -603,8 +638,6 @@ Scl_Tree_t * Scl_LibertyStart( char * pFileName )
     p->pContents = Scl_LibertyFileContents( pFileName, p->nContents );
     // other 
     p->pFileName = Abc_UtilStrsav( pFileName );
-    p->nItermAlloc = 10 + Scl_LibertyCountItems( p->pContents, p->pContents+p->nContents );
-    p->pItems = ABC_CALLOC( Scl_Item_t, p->nItermAlloc );
     p->nItems = 0;
     p->nLines = 1;
     p->vBuffer = Vec_StrStart( 10 );
@@ -624,7 +657,225 @@ void Scl_LibertyStop( Scl_Tree_t * p, int fVerbose )
     ABC_FREE( p->pError );
     ABC_FREE( p );
 }
-Scl_Tree_t * Scl_LibertyParse( char * pFileName, int fVerbose )
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the library on several threads.]
+
+  Description [The body of the top-level group is split into parts after
+  the closing braces of its child groups. Each part is parsed into its own
+  array of items by Scl_LibertyBuildItem(), exactly as the serial parser
+  would parse it, and the arrays are concatenated, which reproduces the
+  serial item numbering and line counting. Returns 0 if the file does not
+  have one large top-level group or if some part failed to parse; the
+  caller then parses the file serially.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+// finds the brace matching the one at pPos, using word-level scanning to skip
+// the text without braces, and records the top-level group ends after each pStep bytes
+static char * Scl_LibertyFindMatchSplit( char * pPos, char * pEnd, long nStep, Vec_Ptr_t * vSplits )
+{
+    char * pNext = pPos + nStep;
+    long Counter = 1;
+    word Data, Mask;
+    assert( *pPos == '{' );
+    for ( pPos++; pPos < pEnd; pPos++ )
+    {
+        // skip 8 bytes at a time while none of them is '{' or '}'
+        while ( pPos + 8 <= pEnd )
+        {
+            memcpy( &Data, pPos, 8 );
+            Data = (Data | ABC_CONST(0x0606060606060606)) ^ ABC_CONST(0x7F7F7F7F7F7F7F7F);
+            Mask = (Data - ABC_CONST(0x0101010101010101)) & ~Data & ABC_CONST(0x8080808080808080);
+            if ( Mask )
+                break;
+            pPos += 8;
+        }
+        if ( pPos == pEnd )
+            break;
+        if ( *pPos == '{' )
+            Counter++;
+        else if ( *pPos == '}' )
+        {
+            if ( --Counter == 0 )
+                return pPos;
+            if ( Counter == 1 && pPos >= pNext )
+            {
+                Vec_PtrPush( vSplits, pPos + 1 );
+                pNext = pPos + nStep;
+            }
+        }
+    }
+    return NULL;
+}
+static void Scl_LibertyParseChunk( Scl_Tree_t * p, Scl_Chunk_t * pChunk )
+{
+    Scl_Tree_t * pTree = &pChunk->Tree;
+    char * pPos = pChunk->pBeg;
+    memset( pTree, 0, sizeof(Scl_Tree_t) );
+    pTree->pFileName   = p->pFileName;
+    pTree->pContents   = p->pContents;
+    pTree->nContents   = p->nContents;
+    pTree->nItermAlloc = 10 + Scl_LibertyCountItems( pChunk->pBeg, pChunk->pEnd );
+    pTree->pItems      = ABC_CALLOC( Scl_Item_t, pTree->nItermAlloc );
+    pTree->vBuffer     = Vec_StrStart( 10 );
+    pChunk->iFirst     = Scl_LibertyBuildItem( pTree, &pPos, pChunk->pEnd );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Scl_ParsePth_t_ Scl_ParsePth_t;
+struct Scl_ParsePth_t_
+{
+    Scl_Tree_t *    pTree;        // the main tree
+    Scl_Chunk_t *   pChunks;      // the parts of the file
+    int             nChunks;      // the number of parts
+    atomic_int      iNext;        // the next part to parse
+};
+void * Scl_LibertyParseWorkerThread( void * pArg )
+{
+    Scl_ParsePth_t * pPth = (Scl_ParsePth_t *)pArg;
+    int i;
+    while ( (i = atomic_fetch_add( &pPth->iNext, 1 )) < pPth->nChunks )
+        Scl_LibertyParseChunk( pPth->pTree, pPth->pChunks + i );
+    return NULL;
+}
+
+#endif
+
+int Scl_LibertyParseMt( Scl_Tree_t * p, int nProcs )
+{
+#ifdef ABC_USE_PTHREADS
+    Scl_ParsePth_t Pth, * pPth = &Pth;
+    pthread_t * pThreads;
+    Scl_Chunk_t * pChunk;
+    Scl_Item_t * pRoot, * pItem;
+    Scl_Pair_t Key, Head, Body;
+    Vec_Ptr_t * vSplits;
+    char * pPos = p->pContents, * pEnd = p->pContents + p->nContents;
+    char * pNext, * pStop, * pBodyEnd;
+    long i, k, iLine, iLineBody, Offset, iLast, nItems;
+    int w, status, RetValue = 0;
+    // parse the header of the top-level group: key(head){
+    if ( Scl_LibertySkipSpaces( p, &pPos, pEnd, 0 ) )
+        return 0;
+    Key.Beg = pPos - p->pContents;
+    if ( Scl_LibertySkipEntry( &pPos, pEnd ) )
+        return 0;
+    Key.End = pPos - p->pContents;
+    if ( Scl_LibertySkipSpaces( p, &pPos, pEnd, 0 ) || *pPos != '(' )
+        return 0;
+    pNext = pPos;
+    pStop = Scl_LibertyFindMatch( pNext, pEnd );
+    if ( *pStop != ')' )
+        return 0;
+    Head.Beg = pNext - p->pContents + 1;
+    Head.End = pStop - p->pContents;
+    pPos = pStop + 1;
+    if ( Scl_LibertySkipSpaces( p, &pPos, pEnd, 0 ) || *pPos != '{' )
+        return 0;
+    // find the body and split it into parts
+    vSplits = Vec_PtrAlloc( 100 );
+    Vec_PtrPush( vSplits, pPos + 1 );
+    pBodyEnd = Scl_LibertyFindMatchSplit( pPos, pEnd, Abc_MaxInt(SCL_CHUNK_MIN, p->nContents / (nProcs * SCL_CHUNK_PER_PROC)), vSplits );
+    if ( pBodyEnd == NULL || Vec_PtrSize(vSplits) < 2 )
+    {
+        Vec_PtrFree( vSplits );
+        return 0;
+    }
+    Body.Beg = pPos - p->pContents + 1;
+    Body.End = pBodyEnd - p->pContents;
+    iLine = p->nLines;
+    Head = Scl_LibertyUpdateHead( p, Head );
+    iLineBody = p->nLines;
+    Vec_PtrPush( vSplits, pBodyEnd );
+    // parse the parts
+    pPth->pTree   = p;
+    pPth->nChunks = Vec_PtrSize(vSplits) - 1;
+    pPth->pChunks = ABC_CALLOC( Scl_Chunk_t, pPth->nChunks );
+    for ( i = 0; i < pPth->nChunks; i++ )
+    {
+        pPth->pChunks[i].pBeg = (char *)Vec_PtrEntry( vSplits, i );
+        pPth->pChunks[i].pEnd = (char *)Vec_PtrEntry( vSplits, i+1 );
+    }
+    Vec_PtrFree( vSplits );
+    atomic_store( &pPth->iNext, 0 );
+    nProcs = Abc_MinInt( nProcs, pPth->nChunks );
+    pThreads = ABC_ALLOC( pthread_t, nProcs );
+    for ( w = 1; w < nProcs; w++ )
+    {
+        status = pthread_create( pThreads + w, NULL, Scl_LibertyParseWorkerThread, (void *)pPth );  assert( status == 0 );
+    }
+    Scl_LibertyParseWorkerThread( pPth );
+    for ( w = 1; w < nProcs; w++ )
+    {
+        status = pthread_join( pThreads[w], NULL );  assert( status == 0 );
+    }
+    ABC_FREE( pThreads );
+    for ( i = 0; i < pPth->nChunks; i++ )
+        if ( pPth->pChunks[i].iFirst == -1 )
+            break;
+    if ( i < pPth->nChunks )
+        goto finish;
+    // stitch the parts after the top-level item, followed by the items after its body
+    nItems = 1 + Scl_LibertyCountItems( pBodyEnd + 1, pEnd );
+    for ( i = 0; i < pPth->nChunks; i++ )
+        nItems += pPth->pChunks[i].Tree.nItems;
+    p->nItermAlloc = 10 + nItems;
+    p->pItems = ABC_CALLOC( Scl_Item_t, p->nItermAlloc );
+    p->nLines = iLine;
+    pRoot = Scl_LibertyNewItem( p, SCL_LIBERTY_PROC );
+    pRoot->Key  = Key;
+    pRoot->Head = Head;
+    pRoot->Body = Body;
+    pRoot->Child = -2;
+    p->nLines = iLineBody;
+    iLast = -1;
+    for ( i = 0; i < pPth->nChunks; i++ )
+    {
+        pChunk = pPth->pChunks + i;
+        Offset = p->nItems;
+        for ( k = 0; k < pChunk->Tree.nItems; k++ )
+        {
+            pItem = p->pItems + p->nItems++;
+            *pItem = pChunk->Tree.pItems[k];
+            pItem->iLine += p->nLines;
+            if ( pItem->Next >= 0 )
+                pItem->Next += Offset;
+            if ( pItem->Child >= 0 )
+                pItem->Child += Offset;
+        }
+        p->nLines += pChunk->Tree.nLines;
+        if ( pChunk->iFirst < 0 )
+            continue;
+        // link the first top-level item of this part to the last one of the previous part
+        if ( iLast == -1 )
+            pRoot->Child = Offset + pChunk->iFirst;
+        else
+            p->pItems[iLast].Next = Offset + pChunk->iFirst;
+        for ( iLast = Offset + pChunk->iFirst; p->pItems[iLast].Next >= 0; iLast = p->pItems[iLast].Next );
+    }
+    pPos = pBodyEnd + 1;
+    pRoot->Next = Scl_LibertyBuildItem( p, &pPos, pEnd );
+    RetValue = (pRoot->Next != -1);
+finish:
+    for ( i = 0; i < pPth->nChunks; i++ )
+    {
+        ABC_FREE( pPth->pChunks[i].Tree.pItems );
+        ABC_FREE( pPth->pChunks[i].Tree.pError );
+        Vec_StrFreeP( &pPth->pChunks[i].Tree.vBuffer );
+    }
+    ABC_FREE( pPth->pChunks );
+    return RetValue;
+#else
+    return 0;
+#endif
+}
+Scl_Tree_t * Scl_LibertyParse( char * pFileName, int nProcs, int fVerbose )
 {
     Scl_Tree_t * p;
     char * pPos;
@@ -632,6 +883,21 @@ Scl_Tree_t * Scl_LibertyParse( char * pFileName, int fVerbose )
         return NULL;
     pPos = p->pContents;
     Scl_LibertyWipeOutComments( p->pContents, p->pContents+p->nContents );
+    if ( nProcs > 1 && p->nContents >= 2 * SCL_CHUNK_MIN && Scl_LibertyParseMt( p, nProcs ) )
+    {
+        if ( fVerbose )
+        {
+            printf( "Parsing finished successfully using %d threads.  ", nProcs );
+            Abc_PrintTime( 1, "Parsing time", Abc_Clock() - p->clkStart );
+        }
+        return p;
+    }
+    // parse serially, starting over if the parallel parser gave up
+    ABC_FREE( p->pItems );
+    p->nItems = 0;
+    p->nLines = 1;
+    p->nItermAlloc = 10 + Scl_LibertyCountItems( p->pContents, p->pContents+p->nContents );
+    p->pItems = ABC_CALLOC( Scl_Item_t, p->nItermAlloc );
     if ( (!Scl_LibertyBuildItem( p, &pPos, p->pContents + p->nContents )) == 0 )
     {
         if ( p->pError ) printf( "%s", p->pError );
@@ -1702,12 +1968,12 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use )
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int nProcs, int fVerbose, int fVeryVerbose, SC_DontUse dont_use )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
-    p = Scl_LibertyParse( pFileName, fVeryVerbose );
+    p = Scl_LibertyParse( pFileName, nProcs, fVeryVerbose );
     if ( p == NULL )
         return NULL;
 //    Scl_LibertyParseDump( p, "temp_.lib" );
@@ -1727,6 +1993,237 @@ SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, S
     return pLib;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Parsed-library cache.]
+
+  Description [The cache file "<lib>.sclc" is written next to the Liberty
+  file. It contains a fixed header followed by the SCL string produced by
+  Scl_LibertyReadSclStr(). The header records the size and the content hash
+  of the Liberty file and the hash of the dont_use list, so a stale cache
+  is never used. The cache is memory-mapped read-only, which lets several
+  processes share the same pages, and is deserialized without parsing.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SCL_CACHE_MAGIC    "ABCSCLC"
+#define SCL_CACHE_VERSION  1
+
+typedef struct Scl_CacheHead_t_ Scl_CacheHead_t;
+struct Scl_CacheHead_t_
+{
+    char            Magic[8];     // SCL_CACHE_MAGIC
+    int             Version;      // SCL_CACHE_VERSION
+    int             SclVersion;   // ABC_SCL_CUR_VERSION
+    word            FileSize;     // the size of the Liberty file
+    word            FileHash;     // the hash of the Liberty file contents
+    word            OptsHash;     // the hash of the options affecting the result
+    word            DataSize;     // the size of the SCL string following the header
+};
+
+static inline word Scl_LibertyHashWord( word Hash, word Data )
+{
+    Hash ^= Data;
+    Hash *= ABC_CONST(0x9E3779B97F4A7C15);
+    return Hash ^ (Hash >> 29);
+}
+static word Scl_LibertyHashBuffer( word Hash, char * pData, size_t nSize )
+{
+    word Data; size_t i;
+    for ( i = 0; i + 8 <= nSize; i += 8 )
+    {
+        memcpy( &Data, pData + i, 8 );
+        Hash = Scl_LibertyHashWord( Hash, Data );
+    }
+    for ( ; i < nSize; i++ )
+        Hash = Scl_LibertyHashWord( Hash, (word)(unsigned char)pData[i] );
+    return Hash;
+}
+static int Scl_LibertyHashFile( char * pFileName, word * pFileSize, word * pFileHash )
+{
+    int nBufSize = (1 << 20);
+    char * pBuffer;
+    word Hash = ABC_CONST(0xCBF29CE484222325), Size = 0;
+    size_t nRead;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    pBuffer = ABC_ALLOC( char, nBufSize );
+    while ( (nRead = fread( pBuffer, 1, nBufSize, pFile )) > 0 )
+    {
+        Hash  = Scl_LibertyHashBuffer( Hash, pBuffer, nRead );
+        Size += nRead;
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    *pFileSize = Size;
+    *pFileHash = Scl_LibertyHashWord( Hash, Size );
+    return 1;
+}
+static word Scl_LibertyHashOpts( SC_DontUse dont_use )
+{
+    word Hash = ABC_CONST(0x84222325CBF29CE4);
+    int i;
+    for ( i = 0; i < dont_use.size; i++ )
+        Hash = Scl_LibertyHashBuffer( Hash, dont_use.dont_use_list[i], strlen(dont_use.dont_use_list[i]) + 1 );
+    return Scl_LibertyHashWord( Hash, (word)dont_use.size );
+}
+static char * Scl_LibertyCacheName( char * pFileName )
+{
+    char * pCacheName = ABC_ALLOC( char, strlen(pFileName) + 10 );
+    sprintf( pCacheName, "%s.sclc", pFileName );
+    return pCacheName;
+}
+static void Scl_LibertyCacheHead( Scl_CacheHead_t * pHead, word FileSize, word FileHash, word OptsHash, word DataSize )
+{
+    memset( pHead, 0, sizeof(Scl_CacheHead_t) );
+    memcpy( pHead->Magic, SCL_CACHE_MAGIC, 8 );
+    pHead->Version    = SCL_CACHE_VERSION;
+    pHead->SclVersion = ABC_SCL_CUR_VERSION;
+    pHead->FileSize   = FileSize;
+    pHead->FileHash   = FileHash;
+    pHead->OptsHash   = OptsHash;
+    pHead->DataSize   = DataSize;
+}
+static SC_Lib * Scl_LibertyCacheRead( char * pCacheName, Scl_CacheHead_t * pExp )
+{
+    Scl_CacheHead_t * pHead;
+    Vec_Str_t vData;
+    SC_Lib * pLib = NULL;
+    char * pMap;
+    word nMapSize;
+#ifdef _WIN32
+    FILE * pFile = fopen( pCacheName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nMapSize = (word)ftell( pFile );
+    rewind( pFile );
+    pMap = ABC_ALLOC( char, nMapSize + 1 );
+    if ( fread( pMap, 1, nMapSize, pFile ) != nMapSize )
+        nMapSize = 0;
+    fclose( pFile );
+#else
+    struct stat Stat;
+    int fd = open( pCacheName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) != 0 || Stat.st_size < (off_t)sizeof(Scl_CacheHead_t) )
+    {
+        close( fd );
+        return NULL;
+    }
+    nMapSize = (word)Stat.st_size;
+    pMap = (char *)mmap( NULL, nMapSize, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if ( pMap == (char *)MAP_FAILED )
+        return NULL;
+#endif
+    // validate the header and deserialize the library directly from the mapped pages
+    pHead = (Scl_CacheHead_t *)pMap;
+    if ( nMapSize >= sizeof(Scl_CacheHead_t) && 
+         !memcmp( pHead, pExp, sizeof(Scl_CacheHead_t) - sizeof(word) ) && 
+         nMapSize == sizeof(Scl_CacheHead_t) + pHead->DataSize && pHead->DataSize < ABC_INFINITY )
+    {
+        vData.nCap   = vData.nSize = (int)pHead->DataSize;
+        vData.pArray = pMap + sizeof(Scl_CacheHead_t);
+        pLib = Abc_SclReadFromStr( &vData );
+    }
+#ifdef _WIN32
+    ABC_FREE( pMap );
+#else
+    munmap( pMap, nMapSize );
+#endif
+    return pLib;
+}
+static void Scl_LibertyCacheWrite( char * pCacheName, Scl_CacheHead_t * pHead, Vec_Str_t * vStr )
+{
+    // write into a temporary file and rename it, so that concurrent readers never see a partial cache
+    char * pTempName = ABC_ALLOC( char, strlen(pCacheName) + 30 );
+    FILE * pFile;
+    int RetValue;
+#ifdef _WIN32
+    sprintf( pTempName, "%s.%d.tmp", pCacheName, (int)_getpid() );
+#else
+    sprintf( pTempName, "%s.%d.tmp", pCacheName, (int)getpid() );
+#endif
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile == NULL )
+    {
+        ABC_FREE( pTempName );
+        return;
+    }
+    RetValue = fwrite( pHead, sizeof(Scl_CacheHead_t), 1, pFile ) == 1 &&
+               fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile ) == (size_t)Vec_StrSize(vStr);
+    RetValue = (fclose( pFile ) == 0) && RetValue;
+#ifdef _WIN32
+    if ( RetValue )
+        remove( pCacheName );
+#endif
+    if ( !RetValue || rename( pTempName, pCacheName ) != 0 )
+    {
+        printf( "Cannot write library cache \"%s\".\n", pCacheName );
+        remove( pTempName );
+    }
+    ABC_FREE( pTempName );
+}
+SC_Lib * Abc_SclReadLibertyCache( char * pFileName, int nProcs, int fVerbose, int fVeryVerbose, SC_DontUse dont_use )
+{
+    abctime clk = Abc_Clock();
+    Scl_CacheHead_t Head;
+    Scl_Tree_t * p;
+    Vec_Str_t * vStr;
+    SC_Lib * pLib;
+    char * pCacheName;
+    word FileSize, FileHash, OptsHash = Scl_LibertyHashOpts( dont_use );
+    if ( !Scl_LibertyHashFile( pFileName, &FileSize, &FileHash ) )
+        return Abc_SclReadLiberty( pFileName, nProcs, fVerbose, fVeryVerbose, dont_use );
+    pCacheName = Scl_LibertyCacheName( pFileName );
+    // try loading the cache
+    Scl_LibertyCacheHead( &Head, FileSize, FileHash, OptsHash, 0 );
+    pLib = Scl_LibertyCacheRead( pCacheName, &Head );
+    if ( pLib != NULL )
+    {
+        pLib->pFileName = Abc_UtilStrsav( pFileName );
+        Abc_SclLibNormalize( pLib );
+        if ( fVerbose )
+        {
+            printf( "Library \"%s\" from \"%s\" has %d cells (loaded from cache \"%s\").  ", 
+                pLib->pName, pFileName, SC_LibCellNum(pLib), pCacheName );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        ABC_FREE( pCacheName );
+        return pLib;
+    }
+    // parse the Liberty file and save the result in the cache
+    p = Scl_LibertyParse( pFileName, nProcs, fVeryVerbose );
+    if ( p == NULL )
+    {
+        ABC_FREE( pCacheName );
+        return NULL;
+    }
+    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose, dont_use );
+    Scl_LibertyStop( p, fVeryVerbose );
+    if ( vStr == NULL )
+    {
+        ABC_FREE( pCacheName );
+        return NULL;
+    }
+    Scl_LibertyCacheHead( &Head, FileSize, FileHash, OptsHash, (word)Vec_StrSize(vStr) );
+    Scl_LibertyCacheWrite( pCacheName, &Head, vStr );
+    ABC_FREE( pCacheName );
+    pLib = Abc_SclReadFromStr( vStr );
+    Vec_StrFree( vStr );
+    if ( pLib == NULL )
+        return NULL;
+    pLib->pFileName = Abc_UtilStrsav( pFileName );
+    Abc_SclLibNormalize( pLib );
+    return pLib;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Experiments with Liberty parsing.]
@@ -1746,7 +2243,7 @@ void Scl_LibertyTest()
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
 //    return;
-    p = Scl_LibertyParse( pFileName, fVeryVerbose );
+    p = Scl_LibertyParse( pFileName, 1, fVeryVerbose );
     if ( p == NULL )
         return;
 //    Scl_LibertyParseDump( p, "temp_.lib" );
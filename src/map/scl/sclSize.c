@@ -552,7 +552,7 @@ void Abc_SclTimeIncCheckLevel( Abc_Ntk_t * pNtk )
         if ( (int)pObj->Level != Abc_ObjLevelNew(pObj) )
             printf( "Level of node %d is out of date!\n", i );
 }
-int Abc_SclTimeIncUpdate( SC_Man * p )
+int Abc_SclTimeIncUpdate( SC_Man * p, int fDept )
 {
     Abc_Obj_t * pObj;
     int i, RetValue;
@@ -568,7 +568,8 @@ int Abc_SclTimeIncUpdate( SC_Man * p )
     }
     Vec_IntClear( p->vChanged );
     Abc_SclTimeIncUpdateArrival( p );
-    Abc_SclTimeIncUpdateDeparture( p );
+    if ( fDept )
+        Abc_SclTimeIncUpdateDeparture( p );
     Abc_SclTimeIncUpdateClean( p );
     RetValue = p->nIncUpdates;
     p->nIncUpdates = 0;
@@ -593,6 +594,83 @@ void Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj )
     Abc_SclTimeIncUpdateLevel_rec( pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Measures the cost of the incremental timing update.]
+
+  Description [Changes each gate to the next gate in its size ring and 
+  updates timing incrementally after each batch of nBatch changes. 
+  At the end, compares the result with the complete recomputation.]
+               
+  SideEffects [Changes the gate sizes of the manager.]
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeIncBenchmark( SC_Man * p, int nBatch )
+{
+    Abc_Obj_t * pObj;
+    SC_Cell * pCellOld, * pCellNew;
+    SC_Pair * pTimes, * pDepts;
+    float MaxDelayInc, DiffMax = 0;
+    int i, nResizes = 0, nBatches = 0;
+    double nUpdates = 0;
+    abctime clk, clkInc = 0, clkFull;
+    assert( nBatch > 0 );
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+    {
+        pCellOld = Abc_SclObjCell( pObj );
+        pCellNew = pCellOld->pNext;
+        if ( pCellNew == pCellOld )
+            continue;
+        Abc_SclObjSetCell( pObj, pCellNew );
+        Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
+        Abc_SclTimeIncInsert( p, pObj );
+        if ( ++nResizes % nBatch )
+            continue;
+        clk = Abc_Clock();
+        nUpdates += Abc_SclTimeIncUpdate( p, 1 );
+        clkInc += Abc_Clock() - clk;
+        nBatches++;
+    }
+    if ( Vec_IntSize(p->vChanged) )
+    {
+        clk = Abc_Clock();
+        nUpdates += Abc_SclTimeIncUpdate( p, 1 );
+        clkInc += Abc_Clock() - clk;
+        nBatches++;
+    }
+    if ( nResizes == 0 )
+    {
+        printf( "Incremental STA: There are no gates with more than one size.\n" );
+        return;
+    }
+    // compare against the complete recomputation
+    MaxDelayInc = p->MaxDelay;
+    pTimes = ABC_ALLOC( SC_Pair, p->nObjs );
+    pDepts = ABC_ALLOC( SC_Pair, p->nObjs );
+    memcpy( pTimes, p->pTimes, sizeof(SC_Pair) * p->nObjs );
+    memcpy( pDepts, p->pDepts, sizeof(SC_Pair) * p->nObjs );
+    clk = Abc_Clock();
+    Abc_SclTimeNtkRecompute( p, &p->SumArea, &p->MaxDelay, 1, 0 );
+    clkFull = Abc_Clock() - clk;
+    for ( i = 0; i < p->nObjs; i++ )
+    {
+        DiffMax = Abc_MaxFloat( DiffMax, Abc_AbsFloat(pTimes[i].rise - p->pTimes[i].rise) );
+        DiffMax = Abc_MaxFloat( DiffMax, Abc_AbsFloat(pTimes[i].fall - p->pTimes[i].fall) );
+        DiffMax = Abc_MaxFloat( DiffMax, Abc_AbsFloat(pDepts[i].rise - p->pDepts[i].rise) );
+        DiffMax = Abc_MaxFloat( DiffMax, Abc_AbsFloat(pDepts[i].fall - p->pDepts[i].fall) );
+    }
+    ABC_FREE( pTimes );
+    ABC_FREE( pDepts );
+    printf( "Incremental STA: Resized %d gates in %d batches. Updated %.1f objects per batch (out of %d).\n", 
+        nResizes, nBatches, nUpdates / nBatches, Abc_NtkObjNum(p->pNtk) );
+    printf( "Time per resize = %.3f usec.  Full STA = %.3f usec.  ", 
+        1000000.0 * clkInc / CLOCKS_PER_SEC / nResizes, 1000000.0 * clkFull / CLOCKS_PER_SEC );
+    printf( "Delay = %.2f ps (full %.2f ps).  Max mismatch = %.3f ps.\n", 
+        MaxDelayInc, p->MaxDelay, DiffMax );
+}
+
 
 
 /**Function*************************************************************
@@ -683,13 +761,15 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nIncBatch )
 {
     SC_Man * p;
     p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
+    if ( nIncBatch )
+        Abc_SclTimeIncBenchmark( p, nIncBatch );
     Abc_SclManFree( p );
 }
 
@@ -704,12 +784,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nIncBatch )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nIncBatch );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
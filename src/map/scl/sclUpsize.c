@@ -19,6 +19,25 @@
 ***********************************************************************/
 
 #include "sclSize.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,6 +46,29 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SCL_PTH_BATCH_MIN  64   // smaller batches of candidates are evaluated by one thread
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Abc_SclPth_t_ Abc_SclPth_t;
+struct Abc_SclPth_t_
+{
+    SC_Man *         pMan;        // the sizing manager
+    int              nWorkers;    // the number of workers
+    SC_Man **        pWorkers;    // the copies of the manager used by the workers
+    Vec_Int_t *      vCands;      // the candidate nodes
+    Vec_Wec_t *      vRecalcs;    // the nodes to recompute for each candidate
+    Vec_Wec_t *      vEvals;      // the nodes to evaluate for each candidate
+    Vec_Int_t *      vGates;      // the best gate of each candidate
+    Vec_Flt_t *      vGains;      // the best gain of each candidate
+    Vec_Int_t *      vBatch;      // the candidates of the current batch
+    atomic_int       iNext;       // the next candidate of the batch
+    int              Notches;     // the max number of gate sizes tried
+    int              DelayGap;    // the min gain to accept
+};
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -322,6 +364,173 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
     return gateBest;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the upsizing candidates concurrently.]
+
+  Description [Abc_SclFindBestCell() changes the timing of the nodes
+  in the window of the candidate and restores it before returning.
+  Thus, the candidates whose windows, extended by the fanins of the
+  window nodes, do not overlap can be evaluated at the same time using
+  the shared timing data. Each candidate is put into the first of 64 
+  batches where it does not overlap with others; the candidates that 
+  do not fit are evaluated by one thread. Each worker has its own copy 
+  of the manager because the storage for the saved timing is kept in 
+  the manager. The results are the same as when the candidates are 
+  evaluated one after another.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+// the window nodes and the fanins of the candidate are written, the other fanins of the window nodes are read;
+// returns the bit-mask of the batches that do not allow the candidate to be added to them
+static inline word Abc_SclPthFootprintConflicts( Abc_Obj_t * pCand, Vec_Int_t * vRecalcs, word * pWrite, word * pRead )
+{
+    Abc_Obj_t * pObj, * pFanin;
+    word uConf = 0;
+    int i, k;
+    Abc_ObjForEachFanin( pCand, pFanin, k )
+        uConf |= pWrite[Abc_ObjId(pFanin)] | pRead[Abc_ObjId(pFanin)];
+    Abc_NtkForEachObjVec( vRecalcs, pCand->pNtk, pObj, i )
+    {
+        uConf |= pWrite[Abc_ObjId(pObj)] | pRead[Abc_ObjId(pObj)];
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            uConf |= pWrite[Abc_ObjId(pFanin)];
+    }
+    return uConf;
+}
+static inline void Abc_SclPthFootprintAdd( Abc_Obj_t * pCand, Vec_Int_t * vRecalcs, word * pWrite, word * pRead, word uBatch )
+{
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k;
+    Abc_ObjForEachFanin( pCand, pFanin, k )
+        pWrite[Abc_ObjId(pFanin)] |= uBatch;
+    Abc_NtkForEachObjVec( vRecalcs, pCand->pNtk, pObj, i )
+    {
+        pWrite[Abc_ObjId(pObj)] |= uBatch;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            pRead[Abc_ObjId(pFanin)] |= uBatch;
+    }
+}
+void * Abc_SclPthWorkerThread( void * pArg )
+{
+    SC_Man * pW = (SC_Man *)pArg;
+    Abc_SclPth_t * pPth = (Abc_SclPth_t *)pW->pPthMan;
+    float dGainBest;
+    int i, iCand, gateBest, nCands = Vec_IntSize(pPth->vBatch);
+    while ( (i = atomic_fetch_add( &pPth->iNext, 1 )) < nCands )
+    {
+        iCand = Vec_IntEntry( pPth->vBatch, i );
+        gateBest = Abc_SclFindBestCell( pW, Abc_NtkObj(pW->pNtk, Vec_IntEntry(pPth->vCands, iCand)), 
+            Vec_WecEntry(pPth->vRecalcs, iCand), Vec_WecEntry(pPth->vEvals, iCand), pPth->Notches, pPth->DelayGap, &dGainBest );
+        Vec_IntWriteEntry( pPth->vGates, iCand, gateBest );
+        Vec_FltWriteEntry( pPth->vGains, iCand, dGainBest );
+    }
+    return NULL;
+}
+void Abc_SclPthEvalBatch( Abc_SclPth_t * pPth, Vec_Int_t * vBatch, int fSerial )
+{
+    pthread_t * pThreads;
+    int w, status;
+    pPth->vBatch = vBatch;
+    atomic_store( &pPth->iNext, 0 );
+    if ( fSerial || Vec_IntSize(vBatch) < SCL_PTH_BATCH_MIN )
+    {
+        Abc_SclPthWorkerThread( pPth->pWorkers[0] );
+        return;
+    }
+    // the calling thread is the first worker
+    pThreads = ABC_ALLOC( pthread_t, pPth->nWorkers );
+    for ( w = 1; w < pPth->nWorkers; w++ )
+    {
+        status = pthread_create( pThreads + w, NULL, Abc_SclPthWorkerThread, (void *)pPth->pWorkers[w] );  assert( status == 0 );
+    }
+    Abc_SclPthWorkerThread( pPth->pWorkers[0] );
+    for ( w = 1; w < pPth->nWorkers; w++ )
+    {
+        status = pthread_join( pThreads[w], NULL );  assert( status == 0 );
+    }
+    ABC_FREE( pThreads );
+}
+void Abc_SclFindBestCellsPth( SC_Man * p, Vec_Int_t * vCands, int Notches, int DelayGap, int nProcs, Vec_Int_t * vGates, Vec_Flt_t * vGains )
+{
+    Abc_SclPth_t Pth, * pPth = &Pth;
+    Vec_Int_t * vRecalcs, * vEvals, * vBatch;
+    Vec_Wec_t * vBatches;
+    Vec_Wrd_t * vWrite, * vRead;
+    Abc_Obj_t * pObj;
+    SC_Man * pW;
+    word uConf;
+    int i, w, iBatch;
+    memset( pPth, 0, sizeof(Abc_SclPth_t) );
+    pPth->pMan     = p;
+    pPth->nWorkers = nProcs;
+    pPth->vCands   = vCands;
+    pPth->vGates   = vGates;
+    pPth->vGains   = vGains;
+    pPth->Notches  = Notches;
+    pPth->DelayGap = DelayGap;
+    Vec_IntFill( vGates, Vec_IntSize(vCands), -1 );
+    Vec_FltFill( vGains, Vec_IntSize(vCands), 0 );
+    // collect the windows of the candidates and assign each candidate to the first
+    // batch without conflicts; the last batch is evaluated by one thread
+    pPth->vRecalcs = Vec_WecStart( Vec_IntSize(vCands) );
+    pPth->vEvals   = Vec_WecStart( Vec_IntSize(vCands) );
+    vBatches = Vec_WecStart( 65 );
+    vWrite   = Vec_WrdStart( Abc_NtkObjNumMax(p->pNtk) );
+    vRead    = Vec_WrdStart( Abc_NtkObjNumMax(p->pNtk) );
+    Abc_NtkForEachObjVec( vCands, p->pNtk, pObj, i )
+    {
+        vRecalcs = Vec_WecEntry( pPth->vRecalcs, i );
+        vEvals   = Vec_WecEntry( pPth->vEvals, i );
+        Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
+        assert( Vec_IntSize(vEvals) > 0 );
+        uConf = Abc_SclPthFootprintConflicts( pObj, vRecalcs, Vec_WrdArray(vWrite), Vec_WrdArray(vRead) );
+        iBatch = ~uConf ? Abc_Tt6FirstBit(~uConf) : 64;
+        if ( iBatch < 64 )
+            Abc_SclPthFootprintAdd( pObj, vRecalcs, Vec_WrdArray(vWrite), Vec_WrdArray(vRead), (word)1 << iBatch );
+        Vec_WecPush( vBatches, iBatch, i );
+    }
+    Vec_WrdFree( vWrite );
+    Vec_WrdFree( vRead );
+    // create the copies of the manager
+    pPth->pWorkers = ABC_CALLOC( SC_Man *, pPth->nWorkers );
+    for ( w = 0; w < pPth->nWorkers; w++ )
+    {
+        pW = pPth->pWorkers[w] = ABC_ALLOC( SC_Man, 1 );
+        memcpy( pW, p, sizeof(SC_Man) );
+        pW->pPthMan   = pPth;
+        pW->vLoads2   = Vec_FltAlloc( 1000 );
+        pW->vTimes2   = Vec_FltAlloc( 1000 );
+        pW->vTimes3   = Vec_FltAlloc( 1000 );
+        pW->nEstNodes = 0;
+    }
+    // evaluate the batches
+    Vec_WecForEachLevel( vBatches, vBatch, i )
+        if ( Vec_IntSize(vBatch) > 0 )
+            Abc_SclPthEvalBatch( pPth, vBatch, i == 64 );
+    // clean up
+    for ( w = 0; w < pPth->nWorkers; w++ )
+    {
+        pW = pPth->pWorkers[w];
+        p->nEstNodes += pW->nEstNodes;
+        Vec_FltFree( pW->vLoads2 );
+        Vec_FltFree( pW->vTimes2 );
+        Vec_FltFree( pW->vTimes3 );
+        ABC_FREE( pW );
+    }
+    ABC_FREE( pPth->pWorkers );
+    Vec_WecFree( vBatches );
+    Vec_WecFree( pPth->vRecalcs );
+    Vec_WecFree( pPth->vEvals );
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Computes the set of gates to upsize.]
@@ -593,7 +802,7 @@ void Abc_SclObjMarkFanFans( Abc_Obj_t * pObj, Vec_Ptr_t * vNodes )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf )
+int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf, int nProcs )
 {
     SC_Cell * pCellOld, * pCellNew;
     Vec_Int_t * vRecalcs, * vEvals;
@@ -606,6 +815,38 @@ int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notch
     vRecalcs = Vec_IntAlloc( 100 );
     vEvals = Vec_IntAlloc( 100 );
     Vec_QueClear( p->vNodeByGain );
+#ifdef ABC_USE_PTHREADS
+    if ( nProcs > 1 && p->pFuncFanin == NULL && Vec_IntSize(vPathNodes) >= SCL_PTH_BATCH_MIN )
+    {
+        Vec_Int_t * vCands = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Int_t * vGates = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Flt_t * vGains = Vec_FltAlloc( Vec_IntSize(vPathNodes) );
+        Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
+        {
+            assert( pObj->fMarkB == 0 );
+            iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
+            if ( iIterLast >= 0 && iIterLast + 5 > iIter )
+                continue;
+            Vec_IntPush( vCands, Abc_ObjId(pObj) );
+        }
+        Abc_SclFindBestCellsPth( p, vCands, Notches, DelayGap, nProcs, vGates, vGains );
+        // remember savings in the same order as the sequential code
+        Abc_NtkForEachObjVec( vCands, p->pNtk, pObj, i )
+        {
+            gateBest = Vec_IntEntry( vGates, i );
+            if ( gateBest < 0 )
+                continue;
+            assert( Vec_FltEntry(vGains, i) > 0.0 );
+            Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), Vec_FltEntry(vGains, i) );
+            Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), gateBest );
+            Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
+        }
+        Vec_IntFree( vCands );
+        Vec_IntFree( vGates );
+        Vec_FltFree( vGains );
+    }
+    else
+#endif
     Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
     {
         assert( pObj->fMarkB == 0 );
@@ -916,7 +1157,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             if ( pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0 )
                 nUpsizes = Abc_SclFindBypasses( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, pPars->fVeryVerbose );
             else
-                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0) );
+                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0), pPars->nProcs );
             p->timeSize += Abc_Clock() - clk;
 
             // unmark critical path
@@ -937,16 +1178,19 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         if ( pPars->fUseDept )
         {
             if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
-                nConeSize = Abc_SclTimeIncUpdate( p );
+                nConeSize = Abc_SclTimeIncUpdate( p, 1 );
             else
                 Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
         }
+        else if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
+            nConeSize = Abc_SclTimeIncUpdate( p, 0 );
         else
         {
             Vec_Int_t * vTFO = Abc_SclFindTFO( p->pNtk, vPathNodes );
             Abc_SclTimeCone( p, vTFO );
             nConeSize = Vec_IntSize( vTFO );
             Vec_IntFree( vTFO );
+            Vec_IntClear( p->vChanged );
         }
         p->timeTime += Abc_Clock() - clk;
 //        Abc_SclUpsizePrintDiffs( p, pLib, pNtk );
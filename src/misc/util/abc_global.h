@@ -554,6 +554,16 @@ extern word     Abc_RandomW( int fReset );
 
 // pthreads
 extern void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
+typedef struct Util_Steal_t_ Util_Steal_t;
+extern Util_Steal_t * Util_StealStart( int nDeques );
+extern void   Util_StealStop( Util_Steal_t * p, void (*pFreeJob)(void *) );
+extern void   Util_StealAdd( Util_Steal_t * p, int iDeque, void * pJob );
+extern void   Util_StealReturn( Util_Steal_t * p, int iDeque, void * pJob );
+extern void * Util_StealFetch( Util_Steal_t * p, int iDeque );
+extern void   Util_StealFinish( Util_Steal_t * p );
+extern void   Util_StealSetStop( Util_Steal_t * p );
+extern int    Util_StealPendingNum( Util_Steal_t * p );
+extern int    Util_StealStealNum( Util_Steal_t * p );
 
 ABC_NAMESPACE_HEADER_END
 
@@ -180,6 +180,168 @@ void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, in
     //    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );    
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Work-stealing job pool.]
+
+  Description [Keeps one deque of jobs per thread. The owner takes jobs 
+  from the back of its deque, while a thread with an empty deque steals 
+  the oldest job from the front of another deque. A thread that finds 
+  no job waits on a condition variable, which is signaled when a job is 
+  added or returned, when the last pending job is finished, and when 
+  the computation is stopped. A job is pending from the time it is 
+  added till the time it is finished. The shared lock is always taken 
+  before the deque locks.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+struct Util_Steal_t_
+{
+    int              nDeques;      // the number of deques (one per thread)
+    Vec_Ptr_t **     pDeques;      // job deques
+    pthread_mutex_t *pMutexes;     // deque locks
+    pthread_mutex_t  Mutex;        // protects the data below
+    pthread_cond_t   Cond;         // signals new jobs or termination
+    int              nPending;     // jobs in the deques or being processed
+    int              fStop;        // the computation is stopped
+    int              nSteals;      // the number of stolen jobs
+};
+
+static inline void Util_StealLock( pthread_mutex_t * pMutex )   { int status = pthread_mutex_lock(pMutex);   assert( status == 0 ); }
+static inline void Util_StealUnlock( pthread_mutex_t * pMutex ) { int status = pthread_mutex_unlock(pMutex); assert( status == 0 ); }
+static inline void Util_StealSignal( Util_Steal_t * p )         { int status = pthread_cond_broadcast(&p->Cond); assert( status == 0 ); }
+
+Util_Steal_t * Util_StealStart( int nDeques )
+{
+    Util_Steal_t * p = ABC_CALLOC( Util_Steal_t, 1 );
+    int i, status;
+    assert( nDeques >= 1 );
+    p->nDeques  = nDeques;
+    p->pDeques  = ABC_ALLOC( Vec_Ptr_t *, nDeques );
+    p->pMutexes = ABC_ALLOC( pthread_mutex_t, nDeques );
+    for ( i = 0; i < nDeques; i++ )
+    {
+        p->pDeques[i] = Vec_PtrAlloc( 100 );
+        status = pthread_mutex_init( p->pMutexes + i, NULL );  assert( status == 0 );
+    }
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->Cond, NULL );    assert( status == 0 );
+    return p;
+}
+void Util_StealStop( Util_Steal_t * p, void (*pFreeJob)(void *) )
+{
+    void * pJob; int i, k;
+    for ( i = 0; i < p->nDeques; i++ )
+    {
+        if ( pFreeJob )
+            Vec_PtrForEachEntry( void *, p->pDeques[i], pJob, k )
+                pFreeJob( pJob );
+        Vec_PtrFree( p->pDeques[i] );
+        pthread_mutex_destroy( p->pMutexes + i );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    ABC_FREE( p->pDeques );
+    ABC_FREE( p->pMutexes );
+    ABC_FREE( p );
+}
+// adds a new pending job to the back of the deque
+void Util_StealAdd( Util_Steal_t * p, int iDeque, void * pJob )
+{
+    Util_StealLock( &p->Mutex );
+    p->nPending++;
+    Util_StealLock( p->pMutexes + iDeque );
+    Vec_PtrPush( p->pDeques[iDeque], pJob );
+    Util_StealUnlock( p->pMutexes + iDeque );
+    Util_StealSignal( p );
+    Util_StealUnlock( &p->Mutex );
+}
+// returns an unfinished job to the front of the deque
+void Util_StealReturn( Util_Steal_t * p, int iDeque, void * pJob )
+{
+    Util_StealLock( &p->Mutex );
+    Util_StealLock( p->pMutexes + iDeque );
+    if ( Vec_PtrSize(p->pDeques[iDeque]) == 0 )
+        Vec_PtrPush( p->pDeques[iDeque], pJob );
+    else
+        Vec_PtrInsert( p->pDeques[iDeque], 0, pJob );
+    Util_StealUnlock( p->pMutexes + iDeque );
+    Util_StealSignal( p );
+    Util_StealUnlock( &p->Mutex );
+}
+// the caller holds the shared lock
+static void * Util_StealTake( Util_Steal_t * p, int iDeque )
+{
+    void * pJob = NULL;
+    int i, iVictim;
+    // try own deque first
+    Util_StealLock( p->pMutexes + iDeque );
+    if ( Vec_PtrSize(p->pDeques[iDeque]) > 0 )
+        pJob = Vec_PtrPop( p->pDeques[iDeque] );
+    Util_StealUnlock( p->pMutexes + iDeque );
+    // steal the oldest job from another deque
+    for ( i = 1; i < p->nDeques && pJob == NULL; i++ )
+    {
+        iVictim = (iDeque + i) % p->nDeques;
+        Util_StealLock( p->pMutexes + iVictim );
+        if ( Vec_PtrSize(p->pDeques[iVictim]) > 0 )
+        {
+            pJob = Vec_PtrEntry( p->pDeques[iVictim], 0 );
+            Vec_PtrDrop( p->pDeques[iVictim], 0 );
+            p->nSteals++;
+        }
+        Util_StealUnlock( p->pMutexes + iVictim );
+    }
+    return pJob;
+}
+// waits for a job; returns NULL when all jobs are finished or the computation is stopped
+void * Util_StealFetch( Util_Steal_t * p, int iDeque )
+{
+    void * pJob = NULL;
+    int status;
+    Util_StealLock( &p->Mutex );
+    while ( !p->fStop && p->nPending > 0 && (pJob = Util_StealTake( p, iDeque )) == NULL )
+    {
+        status = pthread_cond_wait( &p->Cond, &p->Mutex );  assert( status == 0 );
+    }
+    Util_StealUnlock( &p->Mutex );
+    return pJob;
+}
+void Util_StealFinish( Util_Steal_t * p )
+{
+    Util_StealLock( &p->Mutex );
+    assert( p->nPending > 0 );
+    if ( --p->nPending == 0 )
+        Util_StealSignal( p );
+    Util_StealUnlock( &p->Mutex );
+}
+void Util_StealSetStop( Util_Steal_t * p )
+{
+    Util_StealLock( &p->Mutex );
+    p->fStop = 1;
+    Util_StealSignal( p );
+    Util_StealUnlock( &p->Mutex );
+}
+int Util_StealPendingNum( Util_Steal_t * p )
+{
+    int nPending;
+    Util_StealLock( &p->Mutex );
+    nPending = p->nPending;
+    Util_StealUnlock( &p->Mutex );
+    return nPending;
+}
+int Util_StealStealNum( Util_Steal_t * p )
+{
+    int nSteals;
+    Util_StealLock( &p->Mutex );
+    nSteals = p->nSteals;
+    Util_StealUnlock( &p->Mutex );
+    return nSteals;
+}
+
 #endif // pthreads are used
 
 
@@ -244,6 +244,26 @@ static inline void Vec_MemPush( Vec_Mem_t * p, word * pEntry )
     memmove( pPlace, pEntry, sizeof(word) * (size_t)p->nEntrySize );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reserves page pointers for the given number of entries.]
+
+  Description [After this, adding entries up to nEntries does not move
+  the array of page pointers, so the existing entries can be read while 
+  new ones are added.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Vec_MemReserve( Vec_Mem_t * p, int nEntries )
+{
+    int iPageNew = (nEntries >> p->LogPageSze);
+    if ( iPageNew >= p->nPageAlloc )
+        p->ppPages = ABC_REALLOC( word *, p->ppPages, (p->nPageAlloc = Abc_MaxInt(2 * p->nPageAlloc, iPageNew + 32)) );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
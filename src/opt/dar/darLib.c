@@ -105,7 +105,17 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
-static Dar_Lib_t * s_DarLib = NULL;
+static Dar_Lib_t * s_DarLibMain = NULL;
+
+// the library objects and their data are used as scratch memory during rewriting,
+// so a thread running rewriting concurrently with others needs its own copy
+#ifdef _MSC_VER
+static __declspec(thread) Dar_Lib_t * s_DarLibThread = NULL;
+#else
+static __thread Dar_Lib_t * s_DarLibThread = NULL;
+#endif
+
+#define s_DarLib (s_DarLibThread ? s_DarLibThread : s_DarLibMain)
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -593,10 +603,10 @@ Dar_Lib_t * Dar_LibRead()
 void Dar_LibStart()
 {
 //    abctime clk = Abc_Clock();
-    if ( s_DarLib != NULL )
+    if ( s_DarLibMain != NULL )
         return;
-    assert( s_DarLib == NULL );
-    s_DarLib = Dar_LibRead();
+    assert( s_DarLibMain == NULL );
+    s_DarLibMain = Dar_LibRead();
 //    printf( "The 4-input library started with %d nodes and %d subgraphs. ", s_DarLib->nObjs - 4, s_DarLib->nSubgrTotal );
 //    ABC_PRT( "Time", Abc_Clock() - clk );
 }
@@ -614,9 +624,36 @@ void Dar_LibStart()
 ***********************************************************************/
 void Dar_LibStop()
 {
-    assert( s_DarLib != NULL );
-    Dar_LibFree( s_DarLib );
-    s_DarLib = NULL;
+    assert( s_DarLibMain != NULL );
+    Dar_LibFree( s_DarLibMain );
+    s_DarLibMain = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the private copy of the library for the calling thread.]
+
+  Description [Should be called by a thread that performs rewriting
+  concurrently with other threads. The copy is used by all library 
+  procedures called by this thread until Dar_LibStopThread().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_LibStartThread()
+{
+    if ( s_DarLibThread != NULL )
+        return;
+    s_DarLibThread = Dar_LibRead();
+}
+void Dar_LibStopThread()
+{
+    if ( s_DarLibThread == NULL )
+        return;
+    Dar_LibFree( s_DarLibThread );
+    s_DarLibThread = NULL;
 }
 
 /**Function*************************************************************
@@ -23,6 +23,16 @@
 #include "aig/gia/gia.h"
 #include "aig/gia/giaAig.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -618,18 +628,58 @@ int Dar_NewChoiceSynthesisGuard( Aig_Man_t * pAig )
     return (int)(Count > 10);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the last snapshot in a separate thread.]
+
+  Description [The thread uses its own copy of the rewriting library.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Dar_ChoicePth_t_ Dar_ChoicePth_t;
+struct Dar_ChoicePth_t_
+{
+    Aig_Man_t *      pAig;          // the AIG to synthesize (consumed)
+    Gia_Man_t *      pGia;          // the resulting snapshot
+    int              fBalance;      // synthesis parameters
+    int              fUpdateLevel;
+    int              fPower;
+    int              fLightSynth;
+};
+
+void * Dar_NewChoiceSynthesisThread( void * pArg )
+{
+    Dar_ChoicePth_t * p = (Dar_ChoicePth_t *)pArg;
+    Dar_LibStartThread();
+    p->pAig = Dar_NewCompress2( p->pAig, p->fBalance, p->fUpdateLevel, 1, p->fPower, p->fLightSynth, 0 );
+    p->pGia = Gia_ManFromAig( p->pAig );
+    Aig_ManStop( p->pAig );
+    p->pAig = NULL;
+    Dar_LibStopThread();
+    return NULL;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Reproduces script "compress2".]
 
-  Description [Takes AIG manager, consumes it, and produces GIA manager.]
+  Description [Takes AIG manager, consumes it, and produces GIA manager.
+  If nProcs > 1, the last snapshot is derived from the original AIG 
+  (rather than from the second snapshot) in a separate thread.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Dar_NewChoiceSynthesis( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fLightSynth, int fVerbose )
+Gia_Man_t * Dar_NewChoiceSynthesis( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fLightSynth, int nProcs, int fVerbose )
 //alias resyn    "b; rw; rwz; b; rwz; b"
 //alias resyn2   "b; rw; rf; b; rw; rwz; b; rfz; rwz; b"
 {
@@ -648,6 +698,32 @@ Gia_Man_t * Dar_NewChoiceSynthesis( Aig_Man_t * pAig, int fBalance, int fUpdateL
     pGia = Gia_ManFromAig(pAig);
     Vec_PtrPush( vGias, pGia );
 
+#ifdef ABC_USE_PTHREADS
+    if ( nProcs > 1 )
+    {
+        Dar_ChoicePth_t Pth, * pPth = &Pth;
+        pthread_t Thread;
+        int status;
+        pPth->pAig         = Aig_ManDupDfs( pAig );
+        pPth->pGia         = NULL;
+        pPth->fBalance     = fBalance;
+        pPth->fUpdateLevel = fUpdateLevel;
+        pPth->fPower       = fPower;
+        pPth->fLightSynth  = fLightSynth;
+        status = pthread_create( &Thread, NULL, Dar_NewChoiceSynthesisThread, (void *)pPth );  assert( status == 0 );
+
+        pAig = Dar_NewCompress( pAig, fBalance, fUpdateLevel, fPower, fVerbose );
+        pGia = Gia_ManFromAig(pAig);
+        Vec_PtrPush( vGias, pGia );
+        Aig_ManStop( pAig );
+
+        status = pthread_join( Thread, NULL );  assert( status == 0 );
+        Vec_PtrPush( vGias, pPth->pGia );
+        if ( fVerbose ) printf( "Compress2: " ), Gia_ManPrintStats( pPth->pGia, NULL );
+    }
+    else
+#endif
+    {
     pAig = Dar_NewCompress( pAig, fBalance, fUpdateLevel, fPower, fVerbose );
     pGia = Gia_ManFromAig(pAig);
     Vec_PtrPush( vGias, pGia );
@@ -659,6 +735,7 @@ Gia_Man_t * Dar_NewChoiceSynthesis( Aig_Man_t * pAig, int fBalance, int fUpdateL
 //Aig_ManPrintStats( pAig );
 
     Aig_ManStop( pAig );
+    }
 
     // swap around the first and the last
     pTemp = (Gia_Man_t *)Vec_PtrPop( vGias );
@@ -868,7 +945,7 @@ Aig_Man_t * Dar_ManChoiceNew( Aig_Man_t * pAig, Dch_Pars_t * pPars )
 
     // perform synthesis
 clk = Abc_Clock();
-    pGia = Dar_NewChoiceSynthesis( Aig_ManDupDfs(pAig), 1, 1, pPars->fPower, pPars->fLightSynth, pPars->fVerbose );
+    pGia = Dar_NewChoiceSynthesis( Aig_ManDupDfs(pAig), 1, 1, pPars->fPower, pPars->fLightSynth, pPars->nProcs, pPars->fVerbose );
 pPars->timeSynth = Abc_Clock() - clk;
 
     // perform choice computation
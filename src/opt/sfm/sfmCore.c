@@ -21,6 +21,24 @@
 #include "sfmInt.h"
 #include "bool/kit/kit.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -28,6 +46,39 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SFM_PTH_BATCH  16   // the number of nodes per thread in one batch
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Sfm_PthRes_t_ Sfm_PthRes_t;
+struct Sfm_PthRes_t_
+{
+    int              iNode;       // the node
+    int              Status;      // -1 = not tried; 0 = no change; 1 = the change is found
+    int              fWindow;     // the window is computed
+    int              iFanin;      // the fanin to replace (-1 if only the function changes)
+    int              iFaninNew;   // the new fanin (-1 if the fanin is removed)
+    word             uTruth;      // the new truth table
+    word             pTruth[SFM_WORDS_MAX]; // the new truth table (large)
+    Vec_Int_t *      vOrder;      // the window
+    Vec_Int_t *      vDivs;       // the divisors
+    Vec_Int_t *      vRoots;      // the roots
+    Vec_Int_t *      vTfo;        // the TFO
+};
+
+typedef struct Sfm_Pth_t_ Sfm_Pth_t;
+struct Sfm_Pth_t_
+{
+    int              nWorkers;    // the number of workers
+    Sfm_Ntk_t **     pWorkers;    // the copies of the network used by the workers
+    Sfm_Par_t *      pPars;       // the copies of the parameters used by the workers
+    Sfm_PthRes_t *   pRes;        // the results for the nodes of the batch
+    int              nRes;        // the number of nodes in the batch
+    atomic_int       iNext;       // the next node of the batch
+};
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -52,6 +103,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nProcs       =    1;  // the number of threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -214,6 +266,14 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // leave the update to the caller
+    if ( p->fDelayUpdate )
+    {
+        p->iUpdFanin    = f;
+        p->iUpdFaninNew = (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar));
+        p->uUpdTruth    = uTruth;
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth, p->pTruth );
     // the number of fanins cannot increase
@@ -280,18 +340,24 @@ p->timeSat += Abc_Clock() - clk;
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
+    // leave the update to the caller
+    if ( p->fDelayUpdate )
+    {
+        p->iUpdFanin    = -1;
+        p->iUpdFaninNew = -1;
+        p->uUpdTruth    = uTruth;
+        return 1;
+    }
     // update truth table
+    Sfm_ObjMarkChanged( p, iNode );
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
     Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
     return 1;
 }
-int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
+int Sfm_NodeResubWindow( Sfm_Ntk_t * p, int iNode )
 {
     int i, iFanin;
-    p->nNodesTried++;
     // prepare SAT solver
-    if ( !Sfm_NtkCreateWindow( p, iNode, p->pPars->fVeryVerbose ) )
-        return 0;
     if ( !Sfm_NtkWindowToSolver( p ) )
         return 0;
     // try replacing area critical fanins
@@ -325,6 +391,14 @@ int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
 */
     return 0;
 }
+int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
+{
+    p->nNodesTried++;
+    // compute the window
+    if ( !Sfm_NtkCreateWindow( p, iNode, p->pPars->fVeryVerbose ) )
+        return 0;
+    return Sfm_NodeResubWindow( p, iNode );
+}
 
 /**Function*************************************************************
 
@@ -353,6 +427,287 @@ void Sfm_NtkPrint( Sfm_Ntk_t * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution for the nodes using several threads.]
+
+  Description [The nodes are processed in batches. First, the workers
+  compute the windows of the nodes of the batch and solve them without
+  changing the network. Each worker uses a copy of the network, which
+  shares the structure and the functions of the nodes, but has its own 
+  traversal IDs, window, SAT solver and CNF buffers. Next, the changes 
+  are applied in the original order. A result is used if nothing was 
+  changed in the batch before the node, or if the recomputed window is 
+  the same and contains no changed objects. Otherwise, the node is 
+  solved again. The result is the same as when the nodes are processed
+  by one thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+static inline int Sfm_NtkPthNodeType( Sfm_Ntk_t * p, int i )
+{
+    if ( Sfm_ObjIsFixed( p, i ) )
+        return 0;
+    if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
+        return 0;
+    if ( Sfm_ObjFaninNum(p, i) > SFM_SUPP_MAX )
+        return 2;
+    return 1;
+}
+Sfm_Ntk_t * Sfm_NtkPthWorkerStart( Sfm_Ntk_t * p, Sfm_Par_t * pPars, Sfm_Pth_t * pPth )
+{
+    Sfm_Ntk_t * pW = ABC_ALLOC( Sfm_Ntk_t, 1 );
+    int i;
+    memcpy( pW, p, sizeof(Sfm_Ntk_t) );
+    memcpy( pPars, p->pPars, sizeof(Sfm_Par_t) );
+    pPars->fVeryVerbose = 0;
+    pW->pPars        = pPars;
+    pW->pPthMan      = pPth;
+    pW->vChanged     = NULL;
+    pW->fDelayUpdate = 1;
+    // traversal data
+    memset( &pW->vCounts,   0, sizeof(Vec_Int_t) );
+    memset( &pW->vTravIds,  0, sizeof(Vec_Int_t) );
+    memset( &pW->vTravIds2, 0, sizeof(Vec_Int_t) );
+    memset( &pW->vId2Var,   0, sizeof(Vec_Int_t) );
+    memset( &pW->vVar2Id,   0, sizeof(Vec_Int_t) );
+    Vec_IntFill( &pW->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pW->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pW->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pW->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pW->vVar2Id,   2*p->nObjs, -1 );
+    pW->nTravIds  = 0;
+    pW->nTravIds2 = 0;
+    pW->nSatVars  = 0;
+    pW->vCover    = Vec_IntAlloc( 1 << 16 );
+    for ( i = 0; i < SFM_FANIN_MAX; i++ )
+        pW->pTtElems[i] = pW->TtElems[i];
+    // statistics
+    pW->nTryRemoves = pW->nTryImproves = pW->nTryResubs = 0;
+    pW->nRemoves = pW->nImproves = pW->nResubs = 0;
+    pW->nNodesTried = pW->nTotalDivs = pW->nSatCalls = pW->nTimeOuts = pW->nMaxDivs = 0;
+    pW->timeWin = pW->timeDiv = pW->timeCnf = pW->timeSat = 0;
+    // window and SAT solver
+    Sfm_NtkPrepare( pW );
+    pW->nLevelMax = p->nLevelMax;
+    return pW;
+}
+void Sfm_NtkPthWorkerStop( Sfm_Ntk_t * p, Sfm_Ntk_t * pW )
+{
+    // statistics
+    p->nTryRemoves  += pW->nTryRemoves;
+    p->nTryImproves += pW->nTryImproves;
+    p->nTryResubs   += pW->nTryResubs;
+    p->nRemoves     += pW->nRemoves;
+    p->nImproves    += pW->nImproves;
+    p->nResubs      += pW->nResubs;
+    p->nNodesTried  += pW->nNodesTried;
+    p->nTotalDivs   += pW->nTotalDivs;
+    p->nSatCalls    += pW->nSatCalls;
+    p->nTimeOuts    += pW->nTimeOuts;
+    p->nMaxDivs     += pW->nMaxDivs;
+    p->timeWin      += pW->timeWin;
+    p->timeDiv      += pW->timeDiv;
+    p->timeCnf      += pW->timeCnf;
+    p->timeSat      += pW->timeSat;
+    // private data
+    ABC_FREE( pW->vCounts.pArray );
+    ABC_FREE( pW->vTravIds.pArray );
+    ABC_FREE( pW->vTravIds2.pArray );
+    ABC_FREE( pW->vId2Var.pArray );
+    ABC_FREE( pW->vVar2Id.pArray );
+    Vec_IntFree( pW->vCover );
+    Vec_IntFree( pW->vNodes );
+    Vec_IntFree( pW->vDivs );
+    Vec_IntFree( pW->vRoots );
+    Vec_IntFree( pW->vTfo );
+    Vec_WrdFree( pW->vDivCexes );
+    Vec_IntFree( pW->vOrder );
+    Vec_IntFree( pW->vDivVars );
+    Vec_IntFree( pW->vDivIds );
+    Vec_IntFree( pW->vLits );
+    Vec_IntFree( pW->vValues );
+    Vec_WecFree( pW->vClauses );
+    Vec_IntFree( pW->vFaninMap );
+    sat_solver_delete( pW->pSat );
+    ABC_FREE( pW );
+}
+void * Sfm_NtkPthWorkerThread( void * pArg )
+{
+    Sfm_Ntk_t * pW = (Sfm_Ntk_t *)pArg;
+    Sfm_Pth_t * pPth = (Sfm_Pth_t *)pW->pPthMan;
+    Sfm_PthRes_t * pRes;
+    int i;
+    while ( (i = atomic_fetch_add( &pPth->iNext, 1 )) < pPth->nRes )
+    {
+        pRes = pPth->pRes + i;
+        if ( pRes->Status == -1 )
+            continue;
+        pW->nNodesTried++;
+        pRes->fWindow = Sfm_NtkCreateWindow( pW, pRes->iNode, 0 );
+        if ( !pRes->fWindow )
+            continue;
+        // remember the window to compare it after the earlier nodes of the batch are updated
+        Vec_IntClear( pRes->vOrder );  Vec_IntAppend( pRes->vOrder, pW->vOrder );
+        Vec_IntClear( pRes->vDivs );   Vec_IntAppend( pRes->vDivs,  pW->vDivs );
+        Vec_IntClear( pRes->vRoots );  Vec_IntAppend( pRes->vRoots, pW->vRoots );
+        Vec_IntClear( pRes->vTfo );    Vec_IntAppend( pRes->vTfo,   pW->vTfo );
+        pRes->Status = Sfm_NodeResubWindow( pW, pRes->iNode );
+        if ( !pRes->Status )
+            continue;
+        pRes->iFanin    = pW->iUpdFanin;
+        pRes->iFaninNew = pW->iUpdFaninNew;
+        pRes->uTruth    = pW->uUpdTruth;
+        memcpy( pRes->pTruth, pW->pTruth, sizeof(word) * SFM_WORDS_MAX );
+    }
+    return NULL;
+}
+static inline int Sfm_NtkPthWindowIsSame( Sfm_Ntk_t * p, Sfm_PthRes_t * pRes, int fWindow, Vec_Int_t * vStamps, int Stamp )
+{
+    int i, iObj;
+    if ( fWindow != pRes->fWindow )
+        return 0;
+    if ( !fWindow )
+        return 1;
+    if ( !Vec_IntEqual(p->vOrder, pRes->vOrder) || !Vec_IntEqual(p->vDivs, pRes->vDivs) || 
+         !Vec_IntEqual(p->vRoots, pRes->vRoots) || !Vec_IntEqual(p->vTfo, pRes->vTfo) )
+        return 0;
+    Vec_IntForEachEntry( p->vOrder, iObj, i )
+        if ( Vec_IntEntry(vStamps, iObj) == Stamp )
+            return 0;
+    return 1;
+}
+static inline int Sfm_NtkPthCommit( Sfm_Ntk_t * p, Sfm_PthRes_t * pRes )
+{
+    if ( pRes->Status == 0 )
+        return 0;
+    if ( pRes->iFanin >= 0 )
+        Sfm_NtkUpdate( p, pRes->iNode, pRes->iFanin, pRes->iFaninNew, pRes->uTruth, pRes->pTruth );
+    else
+    {
+        Sfm_ObjMarkChanged( p, pRes->iNode );
+        Vec_WrdWriteEntry( p->vTruths, pRes->iNode, pRes->uTruth );
+        Sfm_TruthToCnf( pRes->uTruth, NULL, Sfm_ObjFaninNum(p, pRes->iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, pRes->iNode) );
+    }
+    return 1;
+}
+int Sfm_NtkPerformPth( Sfm_Ntk_t * p, int * pCounterLarge )
+{
+    Sfm_Pth_t Pth, * pPth = &Pth;
+    Sfm_PthRes_t * pRes;
+    Vec_Int_t * vStamps;
+    pthread_t * pThreads;
+    int nBatch = p->pPars->nProcs * SFM_PTH_BATCH;
+    int i, k, w, r, iObj, status, fWindow, fChanged, iBatch, iStart, Counter = 0, fStop = 0, nReused = 0, nResolved = 0;
+    memset( pPth, 0, sizeof(Sfm_Pth_t) );
+    pPth->nWorkers = p->pPars->nProcs;
+    pPth->pWorkers = ABC_CALLOC( Sfm_Ntk_t *, pPth->nWorkers );
+    pPth->pPars    = ABC_CALLOC( Sfm_Par_t, pPth->nWorkers );
+    pPth->pRes     = ABC_CALLOC( Sfm_PthRes_t, nBatch );
+    for ( w = 0; w < pPth->nWorkers; w++ )
+        pPth->pWorkers[w] = Sfm_NtkPthWorkerStart( p, pPth->pPars + w, pPth );
+    for ( r = 0; r < nBatch; r++ )
+    {
+        pPth->pRes[r].vOrder = Vec_IntAlloc( 100 );
+        pPth->pRes[r].vDivs  = Vec_IntAlloc( 100 );
+        pPth->pRes[r].vRoots = Vec_IntAlloc( 100 );
+        pPth->pRes[r].vTfo   = Vec_IntAlloc( 100 );
+    }
+    pThreads = ABC_ALLOC( pthread_t, pPth->nWorkers );
+    vStamps = Vec_IntStartFull( p->nObjs );
+    p->vChanged = Vec_IntAlloc( 100 );
+    for ( iBatch = 0, iStart = p->nPis; !fStop && iStart + p->nPos < p->nObjs; iBatch++, iStart += nBatch )
+    {
+        // collect the nodes of the batch
+        pPth->nRes = Abc_MinInt( nBatch, p->nObjs - p->nPos - iStart );
+        for ( r = 0; r < pPth->nRes; r++ )
+        {
+            pRes = pPth->pRes + r;
+            pRes->iNode   = iStart + r;
+            pRes->Status  = Sfm_NtkPthNodeType(p, pRes->iNode) == 1 ? 0 : -1;
+            pRes->fWindow = 0;
+        }
+        // solve them without changing the network (the calling thread is the first worker)
+        atomic_store( &pPth->iNext, 0 );
+        for ( w = 1; w < pPth->nWorkers; w++ )
+        {
+            status = pthread_create( pThreads + w, NULL, Sfm_NtkPthWorkerThread, (void *)pPth->pWorkers[w] );  assert( status == 0 );
+        }
+        Sfm_NtkPthWorkerThread( pPth->pWorkers[0] );
+        for ( w = 1; w < pPth->nWorkers; w++ )
+        {
+            status = pthread_join( pThreads[w], NULL );  assert( status == 0 );
+        }
+        // apply the changes in the original order
+        fChanged = 0;
+        for ( r = 0; r < pPth->nRes; r++ )
+        {
+            pRes = pPth->pRes + r;
+            i = pRes->iNode;
+            k = Sfm_NtkPthNodeType( p, i );
+            if ( k == 0 )
+                continue;
+            if ( k == 2 )
+            {
+                (*pCounterLarge)++;
+                continue;
+            }
+            if ( pRes->Status == -1 )
+                k = Sfm_NodeResub( p, i ), nResolved++;
+            else if ( !fChanged )
+                k = Sfm_NtkPthCommit( p, pRes ), nReused++;
+            else
+            {
+                p->nNodesTried++;
+                fWindow = Sfm_NtkCreateWindow( p, i, p->pPars->fVeryVerbose );
+                if ( Sfm_NtkPthWindowIsSame( p, pRes, fWindow, vStamps, iBatch ) )
+                    k = Sfm_NtkPthCommit( p, pRes ), nReused++;
+                else
+                    k = fWindow ? Sfm_NodeResubWindow( p, i ) : 0, nResolved++;
+            }
+            if ( k )
+                while ( Sfm_NodeResub(p, i) )
+                    k++;
+            Counter += (k > 0);
+            // mark the changed objects
+            Vec_IntForEachEntry( p->vChanged, iObj, w )
+                Vec_IntWriteEntry( vStamps, iObj, iBatch );
+            fChanged |= (Vec_IntSize(p->vChanged) > 0);
+            Vec_IntClear( p->vChanged );
+            if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+            {
+                fStop = 1;
+                break;
+            }
+        }
+    }
+    if ( p->pPars->fVerbose )
+        printf( "Used %d threads. Results used = %d. Nodes solved again = %d.\n", pPth->nWorkers, nReused, nResolved );
+    Vec_IntFreeP( &p->vChanged );
+    Vec_IntFree( vStamps );
+    ABC_FREE( pThreads );
+    for ( r = 0; r < nBatch; r++ )
+    {
+        Vec_IntFree( pPth->pRes[r].vOrder );
+        Vec_IntFree( pPth->pRes[r].vDivs );
+        Vec_IntFree( pPth->pRes[r].vRoots );
+        Vec_IntFree( pPth->pRes[r].vTfo );
+    }
+    for ( w = 0; w < pPth->nWorkers; w++ )
+        Sfm_NtkPthWorkerStop( p, pPth->pWorkers[w] );
+    ABC_FREE( pPth->pWorkers );
+    ABC_FREE( pPth->pPars );
+    ABC_FREE( pPth->pRes );
+    return Counter;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -382,6 +737,11 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+#ifdef ABC_USE_PTHREADS
+    if ( pPars->nProcs > 1 )
+        Counter = Sfm_NtkPerformPth( p, &CounterLarge );
+    else
+#endif
     Sfm_NtkForEachNode( p, i )
     {
         if ( Sfm_ObjIsFixed( p, i ) )
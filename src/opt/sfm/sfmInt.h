@@ -129,6 +129,13 @@ struct Sfm_Ntk_t_
     word *            pTtElems[SFM_FANIN_MAX];
     word              pTruth[SFM_WORDS_MAX];
     word              pCube[SFM_WORDS_MAX];
+    // delayed update
+    int               fDelayUpdate;// record the update instead of applying it
+    int               iUpdFanin;   // the fanin to replace (-1 if only the function changes)
+    int               iUpdFaninNew;// the new fanin (-1 if the fanin is removed)
+    word              uUpdTruth;   // the new truth table
+    Vec_Int_t *       vChanged;    // objects whose fanins, fanouts, or functions changed
+    void *            pPthMan;     // the thread manager
     // nodes
     int               nTotalNodesBeg;
     int               nTotalEdgesBeg;
@@ -177,6 +184,8 @@ static inline void Sfm_ObjSetSatVar( Sfm_Ntk_t * p, int iObj, int Num ) { assert
 static inline void Sfm_ObjCleanSatVar( Sfm_Ntk_t * p, int Num )         { int iObj = Vec_IntEntry(&p->vVar2Id, Num); assert(Vec_IntEntry(&p->vId2Var, iObj) > 0); Vec_IntWriteEntry(&p->vId2Var, iObj, -1);  Vec_IntWriteEntry(&p->vVar2Id, Num, -1); }
 static inline void Sfm_NtkCleanVars( Sfm_Ntk_t * p )                    { int i; for ( i = 1; i < p->nSatVars; i++ )  if ( Vec_IntEntry(&p->vVar2Id, i) != -1 ) Sfm_ObjCleanSatVar( p, i ); }
 
+static inline void Sfm_ObjMarkChanged( Sfm_Ntk_t * p, int iObj )       { if ( p->vChanged ) Vec_IntPush( p->vChanged, iObj );              }
+
 static inline int  Sfm_ObjLevel( Sfm_Ntk_t * p, int iObj )              { return Vec_IntEntry( &p->vLevels, iObj );                         }
 static inline void Sfm_ObjSetLevel( Sfm_Ntk_t * p, int iObj, int Lev )  { Vec_IntWriteEntry( &p->vLevels, iObj, Lev );                      }
 
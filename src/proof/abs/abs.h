@@ -71,6 +71,7 @@ struct Abs_Par_t_
     int            fDumpMabs;          // dumps the original AIG with abstraction map
     int            fCallProver;        // calls the prover
     int            fSimpProver;        // calls simplification before prover
+    int            fConcurrent;        // runs BMC and PDR workers on versions of the abstraction
     char *         pFileVabs;          // dumps the abstracted model into this file
     int            fVerbose;           // verbose flag
     int            fVeryVerbose;       // print additional information
@@ -138,6 +139,8 @@ extern Gia_Man_t *       Gia_ManShrinkGla( Gia_Man_t * p, int nFrameMax, int nTi
 extern void              Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose );
 extern void              Gia_GlaProveCancel( int fVerbose );
 extern int               Gia_GlaProveCheck( int fVerbose );
+extern Vec_Int_t *       Gia_GlaPthPublish( Gia_Man_t * p, int fProver, int fSimpProver, int fVerbose );
+extern Abc_Cex_t *       Gia_GlaPthCheckCex( int fVerbose );
 /*=== absVta.c =========================================================*/
 extern int               Gia_VtaPerform( Gia_Man_t * pAig, Abs_Par_t * pPars );
 /*=== absUtil.c =========================================================*/
@@ -1330,6 +1330,68 @@ Vec_Int_t * Ga2_ManRefine( Ga2_Man_t * p )
     return vVec;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Refines abstraction using the CEX returned by a worker.]
+
+  Description [The CEX is given for the abstraction whose PIs are mapped
+  by vMap into the PIs and PPIs of the original AIG. This abstraction may
+  be older than the current one. Returns the new objects to be added to
+  the abstraction, or NULL if the CEX is valid for the original AIG (in
+  this case, p->pGia->pCexSeq is assigned).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Ga2_ManRefineCex( Ga2_Man_t * p, Abc_Cex_t * pCexAbs, Vec_Int_t * vMap )
+{
+    Abc_Cex_t * pCex;
+    Vec_Int_t * vVec;
+    Gia_Obj_t * pObj;
+    int f, i, k;
+    assert( pCexAbs->nPis == Vec_IntSize(vMap) );
+    pCex = Abc_CexAlloc( 0, Vec_IntSize(vMap), pCexAbs->iFrame+1 );
+    pCex->iFrame = pCexAbs->iFrame;
+    for ( f = 0; f <= pCexAbs->iFrame; f++ )
+        for ( k = 0; k < pCexAbs->nPis; k++ )
+            if ( Abc_InfoHasBit( pCexAbs->pData, pCexAbs->nRegs + f * pCexAbs->nPis + k ) )
+                Abc_InfoSetBit( pCex->pData, f * Vec_IntSize(vMap) + k );
+    vVec = Rnm_ManRefine( p->pRnm, pCex, vMap, p->pPars->fPropFanout, p->pPars->fNewRefine, 1 );
+    if ( Vec_IntSize(vVec) == 0 )
+    {
+        // derive the CEX of the original AIG
+        Abc_Cex_t * pCexOrig = Abc_CexAlloc( Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), pCex->iFrame+1 );
+        pCexOrig->iPo = 0;
+        pCexOrig->iFrame = pCex->iFrame;
+        Gia_ManForEachObjVec( vMap, p->pGia, pObj, k )
+            if ( Gia_ObjIsPi(p->pGia, pObj) )
+                for ( f = 0; f <= pCex->iFrame; f++ )
+                    if ( Abc_InfoHasBit( pCex->pData, f * Vec_IntSize(vMap) + k ) )
+                        Abc_InfoSetBit( pCexOrig->pData, pCexOrig->nRegs + f * pCexOrig->nPis + Gia_ObjCioId(pObj) );
+        Abc_CexFree( pCex );
+        if ( Gia_ManVerifyCex( p->pGia, pCexOrig, 0 ) )
+        {
+            Vec_IntFree( vVec );
+            Abc_CexFreeP( &p->pGia->pCexSeq );
+            p->pGia->pCexSeq = pCexOrig;
+            return NULL;
+        }
+        Abc_CexFree( pCexOrig );
+        return vVec;
+    }
+    Abc_CexFree( pCex );
+    // keep objects that are not abstracted yet
+    k = 0;
+    Gia_ManForEachObjVec( vVec, p->pGia, pObj, i )
+        if ( pObj->fPhase && (Gia_ObjIsAnd(pObj) || Gia_ObjIsRo(p->pGia, pObj)) && !Ga2_ObjIsAbs(p, pObj) )
+            Vec_IntWriteEntry( vVec, k++, Gia_ObjId(p->pGia, pObj) );
+    Vec_IntShrink( vVec, k );
+    p->nObjAdded += Vec_IntSize(vVec);
+    return vVec;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates a new manager.]
@@ -1501,7 +1563,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
 {
     int fUseSecondCore = 1;
     Ga2_Man_t * p;
-    Vec_Int_t * vCore, * vPPis;
+    Vec_Int_t * vCore, * vPPis, * vAbsMap = NULL;
     abctime clk2, clk = Abc_Clock();
     int Status = l_Undef, RetValue = -1, iFrameTryToProve = -1, fOneIsSent = 0;
     int i, c, f, Lit;
@@ -1789,6 +1851,46 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     goto finish;
                 }
             }
+            // refine using CEXes of the workers and publish the new abstraction
+            if ( p->pPars->fConcurrent )
+            {
+                Abc_Cex_t * pCexAbs = Gia_GlaPthCheckCex( pPars->fVeryVerbose );
+                int fPublish = (c > 0 || vAbsMap == NULL);
+                int fProve   = (p->pPars->nFramesNoChange == p->pPars->nFramesNoChangeLim);
+                if ( pCexAbs && vAbsMap )
+                {
+                    clk2 = Abc_Clock();
+                    vPPis = Ga2_ManRefineCex( p, pCexAbs, vAbsMap );
+                    p->timeCex += Abc_Clock() - clk2;
+                    if ( pPars->fVeryVerbose )
+                        Abc_Print( 1, "Worker CEX in frame %d %s.\n", pCexAbs->iFrame, vPPis ? "refines abstraction" : "is valid" );
+                    Abc_CexFree( pCexAbs );
+                    if ( vPPis == NULL )
+                    {
+                        f = pAig->pCexSeq->iFrame;
+                        goto finish;
+                    }
+                    if ( Vec_IntSize(vPPis) > 0 )
+                    {
+                        p->nCexes++;
+                        Ga2_ManAddToAbs( p, vPPis );
+                        Vec_IntFreeP( &pAig->vGateClasses );
+                        pAig->vGateClasses = Ga2_ManAbsTranslate( p );
+                        p->pPars->nFramesNoChange = 0;
+                        fPublish = 1;
+                        fProve = 0;
+                    }
+                    Vec_IntFree( vPPis );
+                }
+                if ( fPublish || fProve )
+                {
+                    Vec_IntFreeP( &vAbsMap );
+                    vAbsMap = Gia_GlaPthPublish( pAig, fProve, pPars->fSimpProver, pPars->fVeryVerbose );
+                    iFrameTryToProve = f;
+                    if ( fProve )
+                        p->nPdrCalls++;
+                }
+            }
             // check the number of stable frames
             if ( p->pPars->nFramesNoChange == p->pPars->nFramesNoChangeLim )
             {
@@ -1804,7 +1906,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     Ga2_GlaDumpAbsracted( p, pPars->fVerbose );
                 }
                 // call the prover
-                if ( p->pPars->fCallProver )
+                if ( p->pPars->fCallProver && !p->pPars->fConcurrent )
                 {
                     // cancel old one if it is proving
                     if ( iFrameTryToProve >= 0 )
@@ -1839,6 +1941,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     }
 finish:
     Prf_ManStopP( &p->pSat->pPrf2 );
+    Vec_IntFreeP( &vAbsMap );
     // cancel old one if it is proving
     if ( iFrameTryToProve >= 0 )
         Gia_GlaProveCancel( pPars->fVerbose );
@@ -21,6 +21,7 @@
 #include "abs.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "sat/bmc/bmc.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -45,6 +46,8 @@ ABC_NAMESPACE_IMPL_START
 void Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose ) {}
 void Gia_GlaProveCancel( int fVerbose )                                    {}
 int  Gia_GlaProveCheck( int fVerbose )                                     { return 0; }
+Vec_Int_t * Gia_GlaPthPublish( Gia_Man_t * p, int fProver, int fSimpProver, int fVerbose ) { return NULL; }
+Abc_Cex_t * Gia_GlaPthCheckCex( int fVerbose )                            { return NULL; }
 
 #else // pthreads are used
 
@@ -53,6 +56,7 @@ typedef struct Abs_ThData_t_
 {
     Aig_Man_t * pAig;
     int         fVerbose;
+    int         fPostCex;
     int         RunId;
 } Abs_ThData_t;
 
@@ -60,10 +64,21 @@ typedef struct Abs_ThData_t_
 pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
 static volatile int g_nRunIds = 0;             // the number of the last prover instance
 static volatile int g_fAbstractionProved = 0;  // set to 1 when prover successed to prove
+static Abc_Cex_t *  g_pCexAbs = NULL;          // CEX of the current abstraction found by a worker
 
 // call back procedure for PDR
 int Abs_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIds; }
 
+// records the CEX of a worker if it refers to the current abstraction
+void Abs_PostCex( int RunId, Abc_Cex_t * pCex )
+{
+    int status;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    if ( RunId == g_nRunIds && g_pCexAbs == NULL )
+        g_pCexAbs = Abc_CexDup( pCex, pCex->nRegs );
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+}
+
 // test procedure to replace PDR
 int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 {
@@ -110,6 +125,8 @@ void * Abs_ProverThread( void * pArg )
         g_fAbstractionProved = 1;
         status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
     }
+    else if ( RetValue == 0 && pThData->fPostCex && pThData->pAig->pSeqModel )
+        Abs_PostCex( pThData->RunId, pThData->pAig->pSeqModel );
     // quit this thread
     if ( pThData->fVerbose )
     {
@@ -129,20 +146,55 @@ void * Abs_ProverThread( void * pArg )
     assert(0);
     return NULL;
 }
-void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
+void * Abs_BmcThread( void * pArg )
+{
+    Abs_ThData_t * pThData = (Abs_ThData_t *)pArg;
+    Saig_ParBmc_t Pars, * pPars = &Pars;
+    int RetValue;
+    // call BMC (all states of a small abstraction are visited in 2^nRegs frames)
+    Saig_ParBmcSetDefaultParams( pPars );
+    pPars->nFramesMax = Aig_ManRegNum(pThData->pAig) < 30 ? (1 << Aig_ManRegNum(pThData->pAig)) : ABC_INFINITY;
+    pPars->fSilent    = 1;
+    pPars->RunId      = pThData->RunId;
+    pPars->pFuncStop  = Abs_CallBackToStop;
+    RetValue = Saig_ManBmcScalable( pThData->pAig, pPars );
+    if ( RetValue == 0 && pThData->pAig->pSeqModel )
+    {
+        if ( pThData->fVerbose )
+            Abc_Print( 1, "BMC found CEX of abstraction %d in frame %d.\n", pThData->RunId, pThData->pAig->pSeqModel->iFrame );
+        Abs_PostCex( pThData->RunId, pThData->pAig->pSeqModel );
+    }
+    // free memory
+    Aig_ManStop( pThData->pAig );
+    ABC_FREE( pThData );
+    // quit this thread
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+Aig_Man_t * Abs_GlaDeriveAbstraction( Gia_Man_t * pGia, int fSimpProver, Vec_Int_t ** pvMap )
 {
-    extern Aig_Man_t * Dar_ManRwsat( Aig_Man_t * pAig, int fBalance, int fVerbose );
-    Abs_ThData_t * pThData;
     Ssw_Pars_t Pars, * pPars = &Pars;
     Aig_Man_t * pAig, * pTemp;
     Gia_Man_t * pAbs;
-    pthread_t ProverThread;
-    int status;
-    // disable verbosity
-//    fVerbose = 0;
+    Gia_Obj_t * pObj, * pObjAbs;
+    int i;
     // create abstraction 
     assert( pGia->vGateClasses != NULL );
     pAbs = Gia_ManDupAbsGates( pGia, pGia->vGateClasses );
+    // map PIs of the abstraction into PIs and PPIs of the original AIG
+    if ( pvMap )
+    {
+        *pvMap = Vec_IntStartFull( Gia_ManPiNum(pAbs) );
+        Gia_ManForEachObj( pGia, pObj, i )
+        {
+            if ( !~pObj->Value )
+                continue;
+            pObjAbs = Gia_ManObj( pAbs, Abc_Lit2Var(pObj->Value) );
+            if ( Gia_ObjIsPi(pAbs, pObjAbs) )
+                Vec_IntWriteEntry( *pvMap, Gia_ObjCioId(pObjAbs), i );
+        }
+    }
     Gia_ManCleanValue( pGia );
     pAig = Gia_ManToAigSimple( pAbs );
     Gia_ManStop( pAbs );
@@ -157,6 +209,19 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
 //Aig_ManPrintStats( pAig );
         Aig_ManStop( pTemp );
     }
+    return pAig;
+}
+void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
+{
+    extern Aig_Man_t * Dar_ManRwsat( Aig_Man_t * pAig, int fBalance, int fVerbose );
+    Abs_ThData_t * pThData;
+    Aig_Man_t * pAig;
+    pthread_t ProverThread;
+    int status;
+    // disable verbosity
+//    fVerbose = 0;
+    // create abstraction 
+    pAig = Abs_GlaDeriveAbstraction( pGia, fSimpProver, NULL );
     // synthesize abstraction
 //    pAig = Dar_ManRwsat( pTemp = pAig, 0, 0 ); 
 //    Aig_ManStop( pTemp );
@@ -181,6 +246,7 @@ void Gia_GlaProveCancel( int fVerbose )
     int status;
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
     g_nRunIds++;
+    Abc_CexFreeP( &g_pCexAbs );
     status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
 }
 int Gia_GlaProveCheck( int fVerbose )
@@ -194,6 +260,83 @@ int Gia_GlaProveCheck( int fVerbose )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Publishes a new version of the abstraction to the workers.]
+
+  Description [Cancels the workers running on the previous version and
+  starts BMC (and PDR, if fProver is set) on the current abstraction
+  given by p->vGateClasses. Returns the map of the abstraction's PIs
+  into the PIs and PPIs of p, which is needed to refine with the CEXes
+  returned by Gia_GlaPthCheckCex().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_GlaPthPublish( Gia_Man_t * pGia, int fProver, int fSimpProver, int fVerbose )
+{
+    Abs_ThData_t * pThData, * pThData2 = NULL;
+    Vec_Int_t * vMap;
+    pthread_t WorkerThread;
+    int status, RunId;
+    // derive abstractions
+    pThData = ABC_CALLOC( Abs_ThData_t, 1 );
+    pThData->pAig = Abs_GlaDeriveAbstraction( pGia, 0, &vMap );
+    if ( fProver )
+    {
+        pThData2 = ABC_CALLOC( Abs_ThData_t, 1 );
+        pThData2->pAig = Abs_GlaDeriveAbstraction( pGia, fSimpProver, NULL );
+    }
+    // create new version
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    RunId = ++g_nRunIds;
+    Abc_CexFreeP( &g_pCexAbs );
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    if ( fVerbose )  Abc_Print( 1, "\nPublished abstraction %d%s.\n", RunId, fProver ? " (trying to prove)" : "" );
+    // start BMC
+    pThData->fVerbose = fVerbose;
+    pThData->fPostCex = 1;
+    pThData->RunId    = RunId;
+    status = pthread_create( &WorkerThread, NULL, Abs_BmcThread, pThData );  assert( status == 0 );
+    pthread_detach( WorkerThread );
+    // start PDR
+    if ( pThData2 )
+    {
+        pThData2->fVerbose = fVerbose;
+        pThData2->fPostCex = 1;
+        pThData2->RunId    = RunId;
+        status = pthread_create( &WorkerThread, NULL, Abs_ProverThread, pThData2 );  assert( status == 0 );
+        pthread_detach( WorkerThread );
+    }
+    return vMap;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the CEX of the current abstraction if a worker found one.]
+
+  Description [The caller is responsible for freeing the CEX.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Gia_GlaPthCheckCex( int fVerbose )
+{
+    Abc_Cex_t * pCex;
+    int status;
+    if ( g_pCexAbs == NULL )
+        return NULL;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    pCex = g_pCexAbs;
+    g_pCexAbs = NULL;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    return pCex;
+}
+
 #endif // pthreads are used
 
 ////////////////////////////////////////////////////////////////////////
@@ -48,6 +48,7 @@ struct Acec_ParCec_t_
     int              fDualOutput;   // dual-output miter
     int              fTwoOutput;    // two-output miter
     int              fBooth;        // expecting Booth multiplier
+    int              nProcs;        // the number of threads
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -81,6 +82,7 @@ extern Vec_Int_t *   Gia_PolynFindOrder( Gia_Man_t * pGia, Vec_Int_t * vFadds, V
 extern void          Gia_PolynBuild( Gia_Man_t * pGia, Vec_Int_t * vOrder, int fSigned, int fVerbose, int fVeryVerbose );
 /*=== acecRe.c ========================================================*/
 extern Vec_Int_t *   Ree_ManComputeCuts( Gia_Man_t * p, Vec_Int_t ** pvXors, int fVerbose );
+extern Vec_Int_t *   Ree_ManComputeCutsPar( Gia_Man_t * p, Vec_Int_t ** pvXors, int nProcs, int fVerbose );
 extern int           Ree_ManCountFadds( Vec_Int_t * vAdds );
 extern void          Ree_ManPrintAdders( Vec_Int_t * vAdds, int fVerbose );
 /*=== acecTree.c ========================================================*/
@@ -55,6 +55,7 @@ void Acec_ManCecSetDefaultParams( Acec_ParCec_t * p )
     p->fMiter         =       0;    // input circuit is a miter
     p->fDualOutput    =       0;    // dual-output miter
     p->fTwoOutput     =       0;    // two-output miter
+    p->nProcs         =       1;    // the number of threads
     p->fSilent        =       0;    // print no messages
     p->fVeryVerbose   =       0;    // verbose stats
     p->fVerbose       =       0;    // verbose stats
@@ -498,8 +499,8 @@ int Acec_Solve( Gia_Man_t * pGia0, Gia_Man_t * pGia1, Acec_ParCec_t * pPars )
 //    Acec_Box_t * pBox1 = Acec_DeriveBox( pGia1, vIgnore1, 0, 0, pPars->fVerbose );
 //    Vec_BitFreeP( &vIgnore0 );
 //    Vec_BitFreeP( &vIgnore1 );
-    Acec_Box_t * pBox0 = Acec_ProduceBox( pGia0, pPars->fVerbose );
-    Acec_Box_t * pBox1 = Acec_ProduceBox( pGia1, pPars->fVerbose );
+    Acec_Box_t * pBox0 = Acec_ProduceBox( pGia0, pPars->nProcs, pPars->fVerbose );
+    Acec_Box_t * pBox1 = Acec_ProduceBox( pGia1, pPars->nProcs, pPars->fVerbose );
     if ( pBox0 == NULL || pBox1 == NULL ) // cannot match
         printf( "Cannot find arithmetic boxes in both LHS and RHS. Trying regular CEC.\n" );
     else if ( !Acec_MatchBoxes( pBox0, pBox1 ) ) // cannot find matching
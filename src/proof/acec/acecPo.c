@@ -22,6 +22,16 @@
 #include "misc/vec/vecWec.h"
 #include "misc/vec/vecHsh.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -636,26 +646,21 @@ static inline void Gia_PolynPrepare4( Vec_Int_t * vTempC[4], Vec_Int_t * vTempM[
     Vec_IntPushUniqueOrder( vTempM[3], iFan1 );
 }
 
-Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, int fSigned, int fVerbose, int fVeryVerbose )
-{
-    abctime clk = Abc_Clock();
-    Vec_Wec_t * vPolyn;
-    Vec_Wec_t * vLit2Mono = Vec_WecStart( Gia_ManObjNum(pGia) ); // mapping AIG literals into monomials
-    Hsh_VecMan_t * pHashC = Hsh_VecManStart( 1000 );    // hash table for constants
-    Hsh_VecMan_t * pHashM = Hsh_VecManStart( 1000 );    // hash table for monomials
-    Vec_Int_t * vCoefs    = Vec_IntAlloc( 1000 );       // monomial coefficients
-    Vec_Int_t * vTempC[4],  * vTempM[4];                // temporary array
-    int i, k, iObj, iLit, iMono, iConst, nMonos = 0, nBuilds = 0;
-    for ( i = 0; i < 4; i++ )
-        vTempC[i] = Vec_IntAlloc( 10 );
-    for ( i = 0; i < 4; i++ )
-        vTempM[i] = Vec_IntAlloc( 10 );
+/**Function*************************************************************
 
-    // add 0-constant and 1-monomial
-    Hsh_VecManAdd( pHashC, vTempC[0] );
-    Hsh_VecManAdd( pHashM, vTempM[0] );
-    Vec_IntPush( vCoefs, 0 );
+  Synopsis    [Creates the output signature.]
+
+  Description []
+               
+  SideEffects []
 
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_PolynBuildSign( Hsh_VecMan_t * pHashC, Hsh_VecMan_t * pHashM, Vec_Int_t * vCoefs, Vec_Wec_t * vLit2Mono, Vec_Int_t * vTempC[4], Vec_Int_t * vTempM[4], 
+                        Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, int fSigned, int fVeryVerbose, int * pnBuilds )
+{
+    int i, k, iLit, nMonos = 0;
     if ( nExtra )
         printf( "Assigning %d outputs from %d to %d rank %d.\n", nExtra, Vec_IntSize(vRootLits)-nExtra, Vec_IntSize(vRootLits)-1, Vec_IntSize(vRootLits)-nExtra );
 
@@ -694,7 +699,7 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
                 Vec_IntPushUniqueOrder( vTempM[0], Abc_Lit2Var(OutLit) );
                 nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[0], vTempM[0] );   // mono with neg out
             }
-            nBuilds++;
+            (*pnBuilds)++;
         }
     }
     else
@@ -709,7 +714,7 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
             {
                 nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[1], vTempM[0] );   // -C
                 nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[0], vTempM[1] );   //  C * Driver
-                nBuilds++;
+                (*pnBuilds)++;
             }
             else
                 nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[1], vTempM[1] );   // -C * Driver
@@ -721,13 +726,48 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
             {
                 nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[0], vTempM[0] );   //  C
                 nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[1], vTempM[1] );   // -C * Driver
-                nBuilds++;
+                (*pnBuilds)++;
             }
             else
                 nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[0], vTempM[1] );   //  C * Driver
         }
-        nBuilds++;
+        (*pnBuilds)++;
     }
+    return nMonos;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Substitutes the internal nodes in the reverse order.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, int fSigned, int fVerbose, int fVeryVerbose )
+{
+    abctime clk = Abc_Clock();
+    Vec_Wec_t * vPolyn;
+    Vec_Wec_t * vLit2Mono = Vec_WecStart( Gia_ManObjNum(pGia) ); // mapping AIG literals into monomials
+    Hsh_VecMan_t * pHashC = Hsh_VecManStart( 1000 );    // hash table for constants
+    Hsh_VecMan_t * pHashM = Hsh_VecManStart( 1000 );    // hash table for monomials
+    Vec_Int_t * vCoefs    = Vec_IntAlloc( 1000 );       // monomial coefficients
+    Vec_Int_t * vTempC[4],  * vTempM[4];                // temporary array
+    int i, k, iObj, iMono, iConst, nMonos = 0, nBuilds = 0;
+    for ( i = 0; i < 4; i++ )
+        vTempC[i] = Vec_IntAlloc( 10 );
+    for ( i = 0; i < 4; i++ )
+        vTempM[i] = Vec_IntAlloc( 10 );
+
+    // add 0-constant and 1-monomial
+    Hsh_VecManAdd( pHashC, vTempC[0] );
+    Hsh_VecManAdd( pHashM, vTempM[0] );
+    Vec_IntPush( vCoefs, 0 );
+
+    nMonos = Gia_PolynBuildSign( pHashC, pHashM, vCoefs, vLit2Mono, vTempC, vTempM, vSign, vRootLits, nExtra, vLeaves, fSigned, fVeryVerbose, &nBuilds );
 
     // perform construction for internal nodes
     Vec_IntForEachEntryReverse( vNodes, iObj, i )
@@ -790,6 +830,445 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
     return vPolyn;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computing for objects using several threads.]
+
+  Description [The monomials are distributed among several shards by
+  their hash value. Each shard has its own tables of constants and
+  monomials, so that the shards are updated concurrently without locks.
+  The internal nodes are substituted in the same reverse order as in
+  Gia_PolynBuildNew(), which keeps the intermediate polynomial small.
+  Each node is substituted in two phases. In the first phase, each shard
+  expands its monomials containing the node and sends the new terms to
+  the shards they belong to. In the second phase, each shard adds the
+  received terms to its tables. The new terms do not contain the node,
+  so the result is the same as that of Gia_PolynBuildNew(). The phases
+  are run by the worker threads only when the node appears in enough
+  monomials; otherwise, the calling thread runs them for all shards.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_POLYN_PAR_MIN 64   // the smallest number of monomials substituted by the threads
+
+typedef struct Gia_PolynShard_t_ Gia_PolynShard_t;
+struct Gia_PolynShard_t_
+{
+    Hsh_VecMan_t *     pHashC;      // hash table for constants
+    Hsh_VecMan_t *     pHashM;      // hash table for monomials
+    Vec_Int_t *        vCoefs;      // monomial coefficients
+    Vec_Wec_t *        vLit2Mono;   // mapping AIG objects into monomials
+    Vec_Int_t **       pvOuts;      // the terms sent to each shard
+    Vec_Int_t *        vTempC[4];   // temporary arrays
+    Vec_Int_t *        vTempM[4];   // temporary arrays
+    int                nMonos;      // the number of used monomials
+    int                nBuilds;     // the number of created terms
+};
+
+typedef struct Gia_PolynPar_t_ Gia_PolynPar_t;
+struct Gia_PolynPar_t_
+{
+    Gia_Man_t *        pGia;        // the AIG
+    int                iObj;        // the node being substituted
+    int                nShards;     // the number of shards (one per thread)
+    Gia_PolynShard_t * pShards;     // the shards
+#ifdef ABC_USE_PTHREADS
+    pthread_t *        pThreads;    // the worker threads
+    pthread_mutex_t    Mutex;       // protects the fields below
+    pthread_cond_t     CondStart;   // signals the start of a phase
+    pthread_cond_t     CondDone;    // signals the end of a phase
+    int                iPhase;      // the number of started phases
+    int                fExpand;     // the current phase
+    int                nPending;    // the number of workers still running
+    int                fStop;       // the workers should terminate
+#endif
+};
+
+Gia_PolynPar_t * Gia_PolynParStart( Gia_Man_t * pGia, int nShards )
+{
+    Gia_PolynPar_t * p = ABC_CALLOC( Gia_PolynPar_t, 1 );
+    Gia_PolynShard_t * pS;
+    int i, s;
+    p->pGia       = pGia;
+    p->nShards    = nShards;
+    p->pShards    = ABC_CALLOC( Gia_PolynShard_t, nShards );
+    for ( s = 0; s < nShards; s++ )
+    {
+        pS = p->pShards + s;
+        pS->pHashC    = Hsh_VecManStart( 1000 );
+        pS->pHashM    = Hsh_VecManStart( 1000 );
+        pS->vCoefs    = Vec_IntAlloc( 1000 );
+        pS->vLit2Mono = Vec_WecStart( Gia_ManObjNum(pGia) );
+        pS->pvOuts    = ABC_ALLOC( Vec_Int_t *, nShards );
+        for ( i = 0; i < nShards; i++ )
+            pS->pvOuts[i] = Vec_IntAlloc( 1000 );
+        for ( i = 0; i < 4; i++ )
+        {
+            pS->vTempC[i] = Vec_IntAlloc( 10 );
+            pS->vTempM[i] = Vec_IntAlloc( 10 );
+        }
+        // add 0-constant
+        Hsh_VecManAdd( pS->pHashC, pS->vTempC[0] );
+    }
+    // add 1-monomial to the shard it belongs to
+    pS = p->pShards + Hsh_VecManHash( p->pShards->vTempM[0], nShards );
+    Hsh_VecManAdd( pS->pHashM, pS->vTempM[0] );
+    Vec_IntPush( pS->vCoefs, 0 );
+    return p;
+}
+void Gia_PolynParStop( Gia_PolynPar_t * p )
+{
+    Gia_PolynShard_t * pS;
+    int i, s;
+    for ( s = 0; s < p->nShards; s++ )
+    {
+        pS = p->pShards + s;
+        Hsh_VecManStop( pS->pHashC );
+        Hsh_VecManStop( pS->pHashM );
+        Vec_IntFree( pS->vCoefs );
+        Vec_WecFree( pS->vLit2Mono );
+        for ( i = 0; i < p->nShards; i++ )
+            Vec_IntFree( pS->pvOuts[i] );
+        ABC_FREE( pS->pvOuts );
+        for ( i = 0; i < 4; i++ )
+        {
+            Vec_IntFree( pS->vTempC[i] );
+            Vec_IntFree( pS->vTempM[i] );
+        }
+    }
+    ABC_FREE( p->pShards );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Expands one monomial w.r.t. the current node.]
+
+  Description [The new terms are sent to their shards as (nConst, Const,
+  nMono, Mono). Monomials containing an XOR node are dropped, as in
+  Gia_PolynBuildNew().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_PolynParSend( Gia_PolynPar_t * p, Gia_PolynShard_t * pS, Vec_Int_t * vConst, Vec_Int_t * vMono )
+{
+    Vec_Int_t * vOut = pS->pvOuts[Hsh_VecManHash(vMono, p->nShards)];
+    Vec_IntPush( vOut, Vec_IntSize(vConst) );
+    Vec_IntAppend( vOut, vConst );
+    Vec_IntPush( vOut, Vec_IntSize(vMono) );
+    Vec_IntAppend( vOut, vMono );
+}
+void Gia_PolynParExpandOne( Gia_PolynPar_t * p, Gia_PolynShard_t * pS, int iConst, int iMono )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, p->iObj );
+    Vec_Int_t ** vTempC = pS->vTempC, ** vTempM = pS->vTempM;
+    if ( Gia_ObjIsXor(pObj) )
+        return;
+    Gia_PolynPrepare4( vTempC, vTempM, Hsh_VecReadEntry(pS->pHashC, iConst), Hsh_VecReadEntry(pS->pHashM, iMono),
+        p->iObj, Gia_ObjFaninId0(pObj, p->iObj), Gia_ObjFaninId1(pObj, p->iObj) );
+    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )  //  C * (1 - x) * (1 - y)
+    {
+        Gia_PolynParSend( p, pS, vTempC[0], vTempM[0] );   //  C * 1
+        Gia_PolynParSend( p, pS, vTempC[1], vTempM[1] );   // -C * x
+        Gia_PolynParSend( p, pS, vTempC[3], vTempM[2] );   // -C * y
+        Gia_PolynParSend( p, pS, vTempC[2], vTempM[3] );   //  C * x * y
+        pS->nBuilds += 3;
+    }
+    else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) ) //  C * (1 - x) * y
+    {
+        Gia_PolynParSend( p, pS, vTempC[0], vTempM[2] );   //  C * y
+        Gia_PolynParSend( p, pS, vTempC[1], vTempM[3] );   // -C * x * y
+        pS->nBuilds += 2;
+    }
+    else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) ) //  C * x * (1 - y)
+    {
+        Gia_PolynParSend( p, pS, vTempC[0], vTempM[1] );   //  C * x
+        Gia_PolynParSend( p, pS, vTempC[1], vTempM[3] );   // -C * x * y
+        pS->nBuilds++;
+    }
+    else
+        Gia_PolynParSend( p, pS, vTempC[0], vTempM[3] );   //  C * x * y
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the two phases of the substitution for one shard.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_PolynParExpand( Gia_PolynPar_t * p, Gia_PolynShard_t * pS )
+{
+    Vec_Int_t * vArray = Vec_WecEntry( pS->vLit2Mono, p->iObj );
+    int k, iMono, iConst;
+    Vec_IntForEachEntry( vArray, iMono, k )
+        if ( (iConst = Vec_IntEntry(pS->vCoefs, iMono)) > 0 )
+        {
+            Gia_PolynParExpandOne( p, pS, iConst, iMono );
+            Vec_IntWriteEntry( pS->vCoefs, iMono, 0 );
+            pS->nMonos--;
+            pS->nBuilds++;
+        }
+}
+void Gia_PolynParCollect( Gia_PolynPar_t * p, Gia_PolynShard_t * pS )
+{
+    int s, * pData, * pLimit, iShard = pS - p->pShards;
+    for ( s = 0; s < p->nShards; s++ )
+    {
+        Vec_Int_t * vIn = p->pShards[s].pvOuts[iShard];
+        pData  = Vec_IntArray( vIn );
+        pLimit = Vec_IntLimit( vIn );
+        while ( pData < pLimit )
+        {
+            Vec_IntClear( pS->vTempC[0] );
+            Vec_IntPushArray( pS->vTempC[0], pData + 1, pData[0] );
+            pData += 1 + pData[0];
+            Vec_IntClear( pS->vTempM[0] );
+            Vec_IntPushArray( pS->vTempM[0], pData + 1, pData[0] );
+            pData += 1 + pData[0];
+            pS->nMonos += Gia_PolynBuildAdd( pS->pHashC, pS->pHashM, pS->vCoefs, pS->vLit2Mono, pS->vTempC[0], pS->vTempM[0] );
+        }
+        assert( pData == pLimit );
+        Vec_IntClear( vIn );
+    }
+}
+void Gia_PolynParRunShard( Gia_PolynPar_t * p, Gia_PolynShard_t * pS, int fExpand )
+{
+    if ( fExpand )
+        Gia_PolynParExpand( p, pS );
+    else
+        Gia_PolynParCollect( p, pS );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one phase for all shards.]
+
+  Description [The worker threads are started once and wait for the
+  phases to run. The calling thread processes the first shard.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Gia_PolynParStartThreads( Gia_PolynPar_t * p ) {}
+void Gia_PolynParStopThreads( Gia_PolynPar_t * p )  {}
+void Gia_PolynParRunPhase( Gia_PolynPar_t * p, int fExpand, int fThreads )
+{
+    int s;
+    for ( s = 0; s < p->nShards; s++ )
+        Gia_PolynParRunShard( p, p->pShards + s, fExpand );
+}
+
+#else // pthreads are used
+
+typedef struct Gia_PolynPth_t_ Gia_PolynPth_t;
+struct Gia_PolynPth_t_
+{
+    Gia_PolynPar_t *   p;
+    Gia_PolynShard_t * pS;
+};
+void * Gia_PolynParWorkerThread( void * pArg )
+{
+    Gia_PolynPth_t * pThData = (Gia_PolynPth_t *)pArg;
+    Gia_PolynPar_t * p = pThData->p;
+    int status, fExpand, iPhase = 0;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+        while ( p->iPhase == iPhase && !p->fStop )
+        {
+            status = pthread_cond_wait( &p->CondStart, &p->Mutex );  assert( status == 0 );
+        }
+        if ( p->fStop )
+        {
+            status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+            break;
+        }
+        iPhase  = p->iPhase;
+        fExpand = p->fExpand;
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+        Gia_PolynParRunShard( p, pThData->pS, fExpand );
+        status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+        if ( --p->nPending == 0 )
+        {
+            status = pthread_cond_signal( &p->CondDone );  assert( status == 0 );
+        }
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    }
+    ABC_FREE( pThData );
+    return NULL;
+}
+void Gia_PolynParStartThreads( Gia_PolynPar_t * p )
+{
+    Gia_PolynPth_t * pThData;
+    int s, status;
+    status = pthread_mutex_init( &p->Mutex, NULL );      assert( status == 0 );
+    status = pthread_cond_init( &p->CondStart, NULL );   assert( status == 0 );
+    status = pthread_cond_init( &p->CondDone, NULL );    assert( status == 0 );
+    p->pThreads = ABC_ALLOC( pthread_t, p->nShards );
+    for ( s = 1; s < p->nShards; s++ )
+    {
+        pThData = ABC_ALLOC( Gia_PolynPth_t, 1 );
+        pThData->p  = p;
+        pThData->pS = p->pShards + s;
+        status = pthread_create( p->pThreads + s, NULL, Gia_PolynParWorkerThread, (void *)pThData );  assert( status == 0 );
+    }
+}
+void Gia_PolynParStopThreads( Gia_PolynPar_t * p )
+{
+    int s, status;
+    status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+    p->fStop = 1;
+    status = pthread_cond_broadcast( &p->CondStart );  assert( status == 0 );
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    for ( s = 1; s < p->nShards; s++ )
+    {
+        status = pthread_join( p->pThreads[s], NULL );  assert( status == 0 );
+    }
+    ABC_FREE( p->pThreads );
+    status = pthread_cond_destroy( &p->CondStart );  assert( status == 0 );
+    status = pthread_cond_destroy( &p->CondDone );   assert( status == 0 );
+    status = pthread_mutex_destroy( &p->Mutex );     assert( status == 0 );
+}
+void Gia_PolynParRunPhase( Gia_PolynPar_t * p, int fExpand, int fThreads )
+{
+    int s, status;
+    if ( !fThreads )
+    {
+        for ( s = 0; s < p->nShards; s++ )
+            Gia_PolynParRunShard( p, p->pShards + s, fExpand );
+        return;
+    }
+    status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+    p->fExpand  = fExpand;
+    p->nPending = p->nShards - 1;
+    p->iPhase++;
+    status = pthread_cond_broadcast( &p->CondStart );  assert( status == 0 );
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    Gia_PolynParRunShard( p, p->pShards, fExpand );
+    status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+    while ( p->nPending > 0 )
+    {
+        status = pthread_cond_wait( &p->CondDone, &p->Mutex );  assert( status == 0 );
+    }
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Computing for objects using several threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Gia_PolynBuildPar( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, int nProcs, int fSigned, int fVerbose, int fVeryVerbose )
+{
+    abctime clk = Abc_Clock();
+    Gia_PolynPar_t * p = Gia_PolynParStart( pGia, nProcs );
+    Gia_PolynShard_t * pS;
+    Vec_Wec_t * vPolyn;
+    Vec_Wec_t * vLit2Mono = Vec_WecAlloc( 100 );
+    Hsh_VecMan_t * pHashC = Hsh_VecManStart( 1000 );
+    Hsh_VecMan_t * pHashM = Hsh_VecManStart( 1000 );
+    Vec_Int_t * vCoefs    = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vTempC[4],  * vTempM[4];
+    int i, s, iObj, iConst, iMono, nCands, nHashC = 0, nHashM = 0, nMonos = 0, nBuilds = 0;
+    for ( i = 0; i < 4; i++ )
+        vTempC[i] = Vec_IntAlloc( 10 );
+    for ( i = 0; i < 4; i++ )
+        vTempM[i] = Vec_IntAlloc( 10 );
+
+    // create output signature in a separate store and distribute it among the shards
+    Hsh_VecManAdd( pHashC, vTempC[0] );
+    Hsh_VecManAdd( pHashM, vTempM[0] );
+    Vec_IntPush( vCoefs, 0 );
+    Gia_PolynBuildSign( pHashC, pHashM, vCoefs, vLit2Mono, vTempC, vTempM, vSign, vRootLits, nExtra, vLeaves, fSigned, fVeryVerbose, &nBuilds );
+    Vec_IntForEachEntry( vCoefs, iConst, iMono )
+    {
+        if ( iConst == 0 )
+            continue;
+        pS = p->pShards + Hsh_VecManHash( Hsh_VecReadEntry(pHashM, iMono), p->nShards );
+        Vec_IntClear( pS->vTempC[0] );
+        Vec_IntAppend( pS->vTempC[0], Hsh_VecReadEntry(pHashC, iConst) );
+        Vec_IntClear( pS->vTempM[0] );
+        Vec_IntAppend( pS->vTempM[0], Hsh_VecReadEntry(pHashM, iMono) );
+        pS->nMonos += Gia_PolynBuildAdd( pS->pHashC, pS->pHashM, pS->vCoefs, pS->vLit2Mono, pS->vTempC[0], pS->vTempM[0] );
+    }
+    Vec_WecFree( vLit2Mono );
+    Hsh_VecManStop( pHashC );
+    Hsh_VecManStop( pHashM );
+    Vec_IntFree( vCoefs );
+
+    // perform construction for internal nodes
+    Gia_PolynParStartThreads( p );
+    Vec_IntForEachEntryReverse( vNodes, iObj, i )
+    {
+        p->iObj = iObj;
+        nCands = 0;
+        for ( s = 0; s < p->nShards; s++ )
+            nCands += Vec_IntSize( Vec_WecEntry(p->pShards[s].vLit2Mono, iObj) );
+        if ( nCands == 0 )
+            continue;
+        Gia_PolynParRunPhase( p, 1, nCands >= GIA_POLYN_PAR_MIN );
+        Gia_PolynParRunPhase( p, 0, nCands >= GIA_POLYN_PAR_MIN );
+    }
+    Gia_PolynParStopThreads( p );
+
+    // collect the result in one store
+    pHashC = Hsh_VecManStart( 1000 );
+    pHashM = Hsh_VecManStart( 1000 );
+    vCoefs = Vec_IntAlloc( 1000 );
+    Vec_IntClear( vTempC[0] );
+    Hsh_VecManAdd( pHashC, vTempC[0] );
+    for ( s = 0; s < p->nShards; s++ )
+    {
+        pS = p->pShards + s;
+        Vec_IntForEachEntry( pS->vCoefs, iConst, iMono )
+            if ( iConst )
+                Vec_IntSetEntry( vCoefs, Hsh_VecManAdd(pHashM, Hsh_VecReadEntry(pS->pHashM, iMono)), Hsh_VecManAdd(pHashC, Hsh_VecReadEntry(pS->pHashC, iConst)) );
+        nHashC  += Hsh_VecSize(pS->pHashC);
+        nHashM  += Hsh_VecSize(pS->pHashM);
+        nMonos  += pS->nMonos;
+        nBuilds += pS->nBuilds;
+    }
+    Vec_IntFillExtra( vCoefs, Hsh_VecSize(pHashM), 0 );
+    vPolyn = Gia_PolynGetResult( pHashC, pHashM, vCoefs );
+
+    printf( "HashC = %d. HashM = %d.  Total = %d. Left = %d.  Used = %d.  Threads = %d.  ",
+        nHashC, nHashM, nBuilds, nMonos, Vec_WecSize(vPolyn)/2, nProcs );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+
+    for ( i = 0; i < 4; i++ )
+        Vec_IntFree( vTempC[i] );
+    for ( i = 0; i < 4; i++ )
+        Vec_IntFree( vTempM[i] );
+    Vec_IntFree( vCoefs );
+    Hsh_VecManStop( pHashC );
+    Hsh_VecManStop( pHashM );
+    Gia_PolynParStop( p );
+    return vPolyn;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -801,7 +1280,7 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigned, int fVerbose, int fVeryVerbose )
+void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int nProcs, int fSigned, int fVerbose, int fVeryVerbose )
 {
     Vec_Wec_t * vPolyn;
     Vec_Int_t * vRootLits = Vec_IntAlloc( Gia_ManCoNum(pGia) );
@@ -842,7 +1321,10 @@ void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigne
         else if ( Gia_ObjIsCo(pObj) )
             Vec_IntPush( vRootLits, Gia_ObjFaninLit0p(pGia, pObj) );
 
-    vPolyn = Gia_PolynBuildNew( pGia, vMonos, vRootLits, nExtra, vLeaves, vNodes, fSigned, fVerbose, fVeryVerbose );
+    if ( nProcs > 1 )
+        vPolyn = Gia_PolynBuildPar( pGia, vMonos, vRootLits, nExtra, vLeaves, vNodes, nProcs, fSigned, fVerbose, fVeryVerbose );
+    else
+        vPolyn = Gia_PolynBuildNew( pGia, vMonos, vRootLits, nExtra, vLeaves, vNodes, fSigned, fVerbose, fVeryVerbose );
     //printf( "Polynomial has %d monomials.\n", Vec_WecSize(vPolyn)/2 );
     if ( fVerbose || fVeryVerbose )
         Gia_PolynPrintStats( vPolyn );
@@ -22,6 +22,24 @@
 #include "misc/vec/vecHash.h"
 #include "misc/util/utilTruth.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -31,6 +49,9 @@ ABC_NAMESPACE_IMPL_START
 
 #define Ree_ForEachCut( pList, pCut, i ) for ( i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += pCut[0] + 2 )
 
+#define REE_PTH_CHUNK       64   // the number of nodes taken by a worker at a time
+#define REE_PTH_LEVEL_MIN  256   // smaller levels are processed by one thread
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -287,14 +308,24 @@ void Ree_ManCutMerge( Gia_Man_t * p, int iObj, int * pList0, int * pList1, Vec_I
         if ( (Truth == 0x66 || Truth == 0x11 || Truth == 0x22 || Truth == 0x44 || Truth == 0x77) && pCut[0] == 2 )
         {
             assert( pCut[0] == 2 );
-            Value = Hsh_Int3ManInsert( pHash, pCut[1], pCut[2], 0 );
-            Vec_IntPushThree( vData, iObj, Value, TruthC );
+            if ( pHash == NULL ) // hashing is done later by the calling thread
+                Vec_IntPushThree( vData, iObj, pCut[1], pCut[2] ), Vec_IntPushTwo( vData, 0, TruthC );
+            else
+            {
+                Value = Hsh_Int3ManInsert( pHash, pCut[1], pCut[2], 0 );
+                Vec_IntPushThree( vData, iObj, Value, TruthC );
+            }
         }
         else if ( Truth == 0x69 || Truth == 0x17 || Truth == 0x2B || Truth == 0x4D || Truth == 0x71 )
         {
             assert( pCut[0] == 3 );
-            Value = Hsh_Int3ManInsert( pHash, pCut[1], pCut[2], pCut[3] );
-            Vec_IntPushThree( vData, iObj, Value, TruthC );
+            if ( pHash == NULL ) // hashing is done later by the calling thread
+                Vec_IntPushThree( vData, iObj, pCut[1], pCut[2] ), Vec_IntPushTwo( vData, pCut[3], TruthC );
+            else
+            {
+                Value = Hsh_Int3ManInsert( pHash, pCut[1], pCut[2], pCut[3] );
+                Vec_IntPushThree( vData, iObj, Value, TruthC );
+            }
         }
         if ( fVerbose )
             Ree_ManCutPrint( pCut, ++Count, TruthC, iObj );
@@ -405,16 +436,9 @@ int Ree_ManCompare( int * pCut0, int * pCut1 )
     if ( pCut0[4] > pCut1[4] ) return  1;
     return 0;
 }
-Vec_Int_t * Ree_ManComputeCuts( Gia_Man_t * p, Vec_Int_t ** pvXors, int fVerbose )
+Vec_Int_t * Ree_ManStartCuts( Gia_Man_t * p )
 {
-    extern void Ree_ManRemoveTrivial( Gia_Man_t * p, Vec_Int_t * vAdds );
-    extern void Ree_ManRemoveContained( Gia_Man_t * p, Vec_Int_t * vAdds );
-    Gia_Obj_t * pObj; 
-    int * pList0, * pList1, i, nCuts = 0;
-    Hash_IntMan_t * pHash = Hash_IntManStart( 1000 );
-    Vec_Int_t * vAdds;
-    Vec_Int_t * vTemp = Vec_IntAlloc( 1000 );
-    Vec_Int_t * vData = Vec_IntAlloc( 1000 );
+    Gia_Obj_t * pObj; int i;
     Vec_Int_t * vCuts = Vec_IntAlloc( 30 * Gia_ManAndNum(p) );
     Vec_IntFill( vCuts, Gia_ManObjNum(p), 0 );
     Gia_ManCleanValue( p );
@@ -426,6 +450,32 @@ Vec_Int_t * Ree_ManComputeCuts( Gia_Man_t * p, Vec_Int_t ** pvXors, int fVerbose
         Vec_IntPush( vCuts, Gia_ObjId(p, pObj) );
         Vec_IntPush( vCuts, 0xAA );
     }
+    return vCuts;
+}
+Vec_Int_t * Ree_ManFinishAdds( Gia_Man_t * p, Hash_IntMan_t * pHash, Vec_Int_t * vData, int fVerbose )
+{
+    extern void Ree_ManRemoveTrivial( Gia_Man_t * p, Vec_Int_t * vAdds );
+    extern void Ree_ManRemoveContained( Gia_Man_t * p, Vec_Int_t * vAdds );
+    Vec_Int_t * vAdds = Ree_ManDeriveAdds( pHash, vData, fVerbose );
+    qsort( Vec_IntArray(vAdds), (size_t)(Vec_IntSize(vAdds)/6), 24, (int (*)(const void *, const void *))Ree_ManCompare );
+    if ( fVerbose )
+        printf( "Adders = %d.  Total cuts = %d.  Hashed cuts = %d.  Hashed/Adders = %.2f.\n", 
+            Vec_IntSize(vAdds)/6, Vec_IntSize(vData)/3, Hash_IntManEntryNum(pHash), 6.0*Hash_IntManEntryNum(pHash)/Vec_IntSize(vAdds) );
+    Vec_IntFree( vData );
+    Hash_IntManStop( pHash );
+    Ree_ManRemoveTrivial( p, vAdds );
+    Ree_ManRemoveContained( p, vAdds );
+    //Ree_ManPrintAdders( vAdds, 1 );
+    return vAdds;
+}
+Vec_Int_t * Ree_ManComputeCuts( Gia_Man_t * p, Vec_Int_t ** pvXors, int fVerbose )
+{
+    Gia_Obj_t * pObj; 
+    int * pList0, * pList1, i, nCuts = 0;
+    Hash_IntMan_t * pHash = Hash_IntManStart( 1000 );
+    Vec_Int_t * vTemp = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vData = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vCuts = Ree_ManStartCuts( p );
     if ( pvXors ) *pvXors = Vec_IntAlloc( 1000 );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -441,19 +491,209 @@ Vec_Int_t * Ree_ManComputeCuts( Gia_Man_t * p, Vec_Int_t ** pvXors, int fVerbose
             Gia_ManAndNum(p), nCuts, 1.0*nCuts/Gia_ManAndNum(p), 1.0*Vec_IntSize(vCuts)/Gia_ManAndNum(p) );
     Vec_IntFree( vTemp );
     Vec_IntFree( vCuts );
-    vAdds = Ree_ManDeriveAdds( pHash, vData, fVerbose );
-    qsort( Vec_IntArray(vAdds), (size_t)(Vec_IntSize(vAdds)/6), 24, (int (*)(const void *, const void *))Ree_ManCompare );
+    return Ree_ManFinishAdds( p, pHash, vData, fVerbose );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Detecting FADDs in the AIG using several threads.]
+
+  Description [The cuts of a node depend only on the cuts of its fanins,
+  so the nodes of one logic level are processed concurrently. Each worker
+  records the cuts, the adder candidates, and the XOR cut of its nodes
+  in a private buffer. After each level, the calling thread copies the
+  cuts into the shared cut storage, which is not modified while the 
+  workers read it. The candidates are hashed at the end in the order of
+  node IDs, so the result is the same as that of Ree_ManComputeCuts().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+Vec_Int_t * Ree_ManComputeCutsPar( Gia_Man_t * p, Vec_Int_t ** pvXors, int nProcs, int fVerbose )
+{
+    return Ree_ManComputeCuts( p, pvXors, fVerbose );
+}
+
+#else // pthreads are used
+
+typedef struct Ree_PthMan_t_ Ree_PthMan_t;
+typedef struct Ree_PthWrk_t_ Ree_PthWrk_t;
+struct Ree_PthWrk_t_
+{
+    Ree_PthMan_t *   pPth;        // the shared data
+    Vec_Int_t *      vBuffer;     // the results of the nodes processed by this worker
+    Vec_Int_t *      vTemp;       // the cuts of one node
+    Vec_Int_t *      vCands;      // the adder candidates of one node
+    Vec_Int_t *      vXors;       // the XOR cut of one node
+};
+struct Ree_PthMan_t_
+{
+    Gia_Man_t *      pGia;        // the AIG
+    Vec_Int_t *      vCuts;       // the cuts of the nodes of the lower levels
+    Vec_Int_t *      vLevel;      // the nodes of the current level
+    atomic_int       iNext;       // the next node of the level to be processed
+    int              fXors;       // collect XOR cuts
+    int              nWorkers;    // the number of workers
+    Ree_PthWrk_t *   pWorkers;    // the workers
+};
+
+Vec_Wec_t * Ree_ManCollectLevels( Gia_Man_t * p )
+{
+    Vec_Wec_t * vLevels = Vec_WecAlloc( 100 );
+    Vec_Int_t * vLevel = Vec_IntStart( Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj; int i, Level;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevel, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevel, Gia_ObjFaninId1(pObj, i)) );
+        Vec_IntWriteEntry( vLevel, i, Level + 1 );
+        Vec_WecPush( vLevels, Level, i );
+    }
+    Vec_IntFree( vLevel );
+    return vLevels;
+}
+void * Ree_ManPthWorkerThread( void * pArg )
+{
+    Ree_PthWrk_t * pW = (Ree_PthWrk_t *)pArg;
+    Ree_PthMan_t * pPth = pW->pPth;
+    Gia_Obj_t * pObj;
+    int * pList0, * pList1, i, iObj, iStart, nNodes = Vec_IntSize(pPth->vLevel);
+    while ( (iStart = atomic_fetch_add( &pPth->iNext, REE_PTH_CHUNK )) < nNodes )
+        for ( i = iStart; i < Abc_MinInt(iStart + REE_PTH_CHUNK, nNodes); i++ )
+        {
+            iObj = Vec_IntEntry( pPth->vLevel, i );
+            pObj = Gia_ManObj( pPth->pGia, iObj );
+            pList0 = Vec_IntEntryP( pPth->vCuts, Vec_IntEntry(pPth->vCuts, Gia_ObjFaninId0(pObj, iObj)) );
+            pList1 = Vec_IntEntryP( pPth->vCuts, Vec_IntEntry(pPth->vCuts, Gia_ObjFaninId1(pObj, iObj)) );
+            Vec_IntClear( pW->vCands );
+            Vec_IntClear( pW->vXors );
+            Ree_ManCutMerge( pPth->pGia, iObj, pList0, pList1, pW->vTemp, NULL, pW->vCands, pPth->fXors ? pW->vXors : NULL );
+            // save the node, its cuts, its candidates (5 entries each), and its XOR cut
+            Vec_IntPushTwo( pW->vBuffer, iObj, Vec_IntSize(pW->vTemp) );
+            Vec_IntAppend( pW->vBuffer, pW->vTemp );
+            Vec_IntPush( pW->vBuffer, Vec_IntSize(pW->vCands) );
+            Vec_IntAppend( pW->vBuffer, pW->vCands );
+            Vec_IntPush( pW->vBuffer, Vec_IntSize(pW->vXors) );
+            Vec_IntAppend( pW->vBuffer, pW->vXors );
+        }
+    return NULL;
+}
+void Ree_ManPthProcessLevel( Ree_PthMan_t * pPth, Vec_Int_t * vLevel )
+{
+    pthread_t * pThreads;
+    int w, status;
+    pPth->vLevel = vLevel;
+    atomic_store( &pPth->iNext, 0 );
+    if ( Vec_IntSize(vLevel) < REE_PTH_LEVEL_MIN )
+    {
+        Ree_ManPthWorkerThread( pPth->pWorkers );
+        return;
+    }
+    // the calling thread is the first worker
+    pThreads = ABC_ALLOC( pthread_t, pPth->nWorkers );
+    for ( w = 1; w < pPth->nWorkers; w++ )
+    {
+        status = pthread_create( pThreads + w, NULL, Ree_ManPthWorkerThread, (void *)(pPth->pWorkers + w) );  assert( status == 0 );
+    }
+    Ree_ManPthWorkerThread( pPth->pWorkers );
+    for ( w = 1; w < pPth->nWorkers; w++ )
+    {
+        status = pthread_join( pThreads[w], NULL );  assert( status == 0 );
+    }
+    ABC_FREE( pThreads );
+}
+Vec_Int_t * Ree_ManComputeCutsPar( Gia_Man_t * p, Vec_Int_t ** pvXors, int nProcs, int fVerbose )
+{
+    Ree_PthMan_t Pth, * pPth = &Pth;
+    Ree_PthWrk_t * pW;
+    Hash_IntMan_t * pHash;
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel, * vData, * vRes, * vResStarts;
+    int * pBuf, * pLimit, * pRes, i, k, w, iObj, nCuts = 0;
+    if ( nProcs < 2 )
+        return Ree_ManComputeCuts( p, pvXors, fVerbose );
+    vLevels = Ree_ManCollectLevels( p );
+    pPth->pGia     = p;
+    pPth->vCuts    = Ree_ManStartCuts( p );
+    pPth->fXors    = (int)(pvXors != NULL);
+    pPth->nWorkers = nProcs;
+    pPth->pWorkers = ABC_CALLOC( Ree_PthWrk_t, nProcs );
+    for ( w = 0; w < nProcs; w++ )
+    {
+        pW = pPth->pWorkers + w;
+        pW->pPth    = pPth;
+        pW->vBuffer = Vec_IntAlloc( 1000 );
+        pW->vTemp   = Vec_IntAlloc( 1000 );
+        pW->vCands  = Vec_IntAlloc( 100 );
+        pW->vXors   = Vec_IntAlloc( 4 );
+    }
+    // the candidates and the XOR cut of each node, in the order of levels
+    vRes       = Vec_IntAlloc( 10 * Gia_ManAndNum(p) );
+    vResStarts = Vec_IntStart( Gia_ManObjNum(p) );
+    Vec_WecForEachLevel( vLevels, vLevel, k )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        Ree_ManPthProcessLevel( pPth, vLevel );
+        for ( w = 0; w < nProcs; w++ )
+        {
+            pW = pPth->pWorkers + w;
+            pBuf   = Vec_IntArray( pW->vBuffer );
+            pLimit = Vec_IntLimit( pW->vBuffer );
+            while ( pBuf < pLimit )
+            {
+                iObj = *pBuf++;
+                Vec_IntWriteEntry( pPth->vCuts, iObj, Vec_IntSize(pPth->vCuts) );
+                Vec_IntPushArray( pPth->vCuts, pBuf + 1, pBuf[0] );
+                nCuts += pBuf[1];
+                pBuf += 1 + pBuf[0];
+                Vec_IntWriteEntry( vResStarts, iObj, Vec_IntSize(vRes) );
+                Vec_IntPushArray( vRes, pBuf, 1 + pBuf[0] );
+                pBuf += 1 + pBuf[0];
+                Vec_IntPushArray( vRes, pBuf, 1 + pBuf[0] );
+                pBuf += 1 + pBuf[0];
+            }
+            assert( pBuf == pLimit );
+            Vec_IntClear( pW->vBuffer );
+        }
+    }
     if ( fVerbose )
-        printf( "Adders = %d.  Total cuts = %d.  Hashed cuts = %d.  Hashed/Adders = %.2f.\n", 
-            Vec_IntSize(vAdds)/6, Vec_IntSize(vData)/3, Hash_IntManEntryNum(pHash), 6.0*Hash_IntManEntryNum(pHash)/Vec_IntSize(vAdds) );
-    Vec_IntFree( vData );
-    Hash_IntManStop( pHash );
-    Ree_ManRemoveTrivial( p, vAdds );
-    Ree_ManRemoveContained( p, vAdds );
-    //Ree_ManPrintAdders( vAdds, 1 );
-    return vAdds;
+        printf( "AIG nodes = %d.  Cuts = %d.  Cuts/Node = %.2f.  Ints/Node = %.2f.  Threads = %d.\n", 
+            Gia_ManAndNum(p), nCuts, 1.0*nCuts/Gia_ManAndNum(p), 1.0*Vec_IntSize(pPth->vCuts)/Gia_ManAndNum(p), nProcs );
+    for ( w = 0; w < nProcs; w++ )
+    {
+        pW = pPth->pWorkers + w;
+        Vec_IntFree( pW->vBuffer );
+        Vec_IntFree( pW->vTemp );
+        Vec_IntFree( pW->vCands );
+        Vec_IntFree( pW->vXors );
+    }
+    ABC_FREE( pPth->pWorkers );
+    Vec_IntFree( pPth->vCuts );
+    Vec_WecFree( vLevels );
+    // hash the candidates and collect the XOR cuts in the order of node IDs
+    pHash = Hash_IntManStart( 1000 );
+    vData = Vec_IntAlloc( 1000 );
+    if ( pvXors ) *pvXors = Vec_IntAlloc( 1000 );
+    Gia_ManForEachAndId( p, iObj )
+    {
+        pRes = Vec_IntEntryP( vRes, Vec_IntEntry(vResStarts, iObj) );
+        for ( i = 0; i < pRes[0]; i += 5 )
+            Vec_IntPushThree( vData, pRes[1+i], Hsh_Int3ManInsert(pHash, pRes[2+i], pRes[3+i], pRes[4+i]), pRes[5+i] );
+        pRes += 1 + pRes[0];
+        if ( pvXors )
+            Vec_IntPushArray( *pvXors, pRes + 1, pRes[0] );
+    }
+    Vec_IntFree( vRes );
+    Vec_IntFree( vResStarts );
+    return Ree_ManFinishAdds( p, pHash, vData, fVerbose );
 }
 
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Highlight nodes inside FAs.]
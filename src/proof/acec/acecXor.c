@@ -372,13 +372,13 @@ Acec_Box_t * Acec_FindBox( Gia_Man_t * p, Vec_Int_t * vAdds, Vec_Wec_t * vAddBox
     return pBox;
 }
 
-Acec_Box_t * Acec_ProduceBox( Gia_Man_t * p, int fVerbose )
+Acec_Box_t * Acec_ProduceBox( Gia_Man_t * p, int nProcs, int fVerbose )
 {
     extern void Acec_TreeVerifyConnections( Gia_Man_t * p, Vec_Int_t * vAdds, Vec_Wec_t * vBoxes );
 
     abctime clk = Abc_Clock();
     Acec_Box_t * pBox = NULL;
-    Vec_Int_t * vXors, * vAdds = Ree_ManComputeCuts( p, &vXors, 0 );
+    Vec_Int_t * vXors, * vAdds = Ree_ManComputeCutsPar( p, &vXors, nProcs, 0 );
     Vec_Int_t * vTemp, * vXorRoots = Acec_FindXorRoots( p, vXors ); 
     Vec_Int_t * vRanks = Acec_RankTrees( p, vXors, vXorRoots ); 
     Vec_Wec_t * vXorLeaves, * vAddBoxes = NULL; 
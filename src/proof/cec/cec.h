@@ -152,6 +152,8 @@ struct Cec_ParCor_t_
     int              nBTLimit;      // conflict limit at a node
     int              nProcs;        // the number of processes
     int              nPartSize;     // the partition size
+    int              nPartMemLimit; // the memory limit per partition in MB (0 = no limit)
+    int              fPartIterate;  // repeats partitioned computation till fix-point
     int              nLevelMax;     // (scorr only) the max number of levels
     int              nStepsMax;     // (scorr only) the max number of induction steps
     int              nLimitMax;     // (scorr only) stop after this many iterations if little or no improvement
@@ -46,7 +46,7 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nCubeDepth, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
 
@@ -737,7 +737,332 @@ finish:
     }
     return RetValue;
 }
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+/**Function*************************************************************
+
+  Synopsis    [Cube-and-conquer: selecting the splitting variable.]
+
+  Description [Returns the PI to be used for extending the cube, or -1 
+  if every PI in the support is already assigned. The cofactor (pCof) 
+  is computed w.r.t. the literals of the cube (vCube).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_GiaCubeIsConst0( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManForEachPo( p, pObj, i )
+        if ( Gia_ObjFaninLit0p(p, pObj) != 0 )
+            return 0;
+    return 1;
+}
+int Cec_GiaCubeSplitVar( Gia_Man_t * pCof, Vec_Int_t * vCube, int LookAhead )
+{
+    Gia_Obj_t * pObj;
+    int i, iLit, nFanouts, Cost, iVar, iBest = -1, CostBest = 0;
+    if ( Gia_ManAndNum(pCof) == 0 )
+        return -1;
+    iVar = Gia_SplitCofVar( pCof, LookAhead, &nFanouts, &Cost );
+    Vec_IntForEachEntry( vCube, iLit, i )
+        if ( Abc_Lit2Var(iLit) == iVar )
+            break;
+    if ( i == Vec_IntSize(vCube) && nFanouts > 0 )
+        return iVar;
+    // the look-ahead returned an assigned variable - fall back on the fanout count
+    Gia_ManForEachPi( pCof, pObj, i )
+        if ( CostBest < Gia_ObjRefNum(pCof, pObj) )
+            iBest = i, CostBest = Gia_ObjRefNum(pCof, pObj);
+    return iBest;
+}
+Gia_Man_t * Cec_GiaCubeCofactor( Gia_Man_t * p, Vec_Int_t * vCube )
+{
+    Gia_Man_t * pCof = Gia_ManDup( p ), * pTemp;
+    int i, iLit;
+    Vec_IntForEachEntry( vCube, iLit, i )
+    {
+        pCof = Gia_ManDupCofactorVar( pTemp = pCof, Abc_Lit2Var(iLit), !Abc_LitIsCompl(iLit) );
+        Gia_ManStop( pTemp );
+    }
+    return pCof;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cube-and-conquer: look-ahead cuber.]
+
+  Description [Recursively cofactors the miter up to the given depth, 
+  choosing the splitting variable by look-ahead on the cofactor sizes. 
+  Cubes whose cofactors reduce to constant-0 outputs are refuted 
+  without calling the SAT solver. The literals follow the convention 
+  of vCofVars: the complemented literal means the PI is set to 0.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_GiaCubeGenerate_rec( Gia_Man_t * pCof, Vec_Int_t * vCube, int nDepth, int LookAhead, Vec_Ptr_t * vCubes, double * pProgress )
+{
+    Gia_Man_t * pPart;
+    int Value, iVar;
+    if ( Cec_GiaCubeIsConst0(pCof) )
+    {
+        *pProgress += 1.0 / pow((double)2, (double)Vec_IntSize(vCube));
+        return;
+    }
+    iVar = Vec_IntSize(vCube) < nDepth ? Cec_GiaCubeSplitVar( pCof, vCube, LookAhead ) : -1;
+    if ( iVar == -1 )
+    {
+        Vec_PtrPush( vCubes, Vec_IntDup(vCube) );
+        return;
+    }
+    for ( Value = 0; Value < 2; Value++ )
+    {
+        pPart = Gia_ManDupCofactorVar( pCof, iVar, Value );
+        Vec_IntPush( vCube, Abc_Var2Lit(iVar, !Value) );
+        Cec_GiaCubeGenerate_rec( pPart, vCube, nDepth, LookAhead, vCubes, pProgress );
+        Vec_IntPop( vCube );
+        Gia_ManStop( pPart );
+    }
+}
+Vec_Ptr_t * Cec_GiaCubeGenerate( Gia_Man_t * p, int nDepth, int LookAhead, double * pProgress )
+{
+    Vec_Ptr_t * vCubes = Vec_PtrAlloc( 1 << Abc_MinInt(nDepth, 16) );
+    Vec_Int_t * vCube = Vec_IntAlloc( nDepth );
+    Gia_Man_t * pCof = Gia_ManDup( p );
+    Cec_GiaCubeGenerate_rec( pCof, vCube, nDepth, LookAhead, vCubes, pProgress );
+    Gia_ManStop( pCof );
+    Vec_IntFree( vCube );
+    return vCubes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cube-and-conquer: work-stealing solver threads.]
+
+  Description [Each thread owns one incremental SAT solver loaded with 
+  the CNF of the complete miter, and solves cubes under assumptions. 
+  The cubes are kept in the work-stealing pool (Util_StealStart), in 
+  which idle threads sleep till a cube becomes available. A cube that
+  times out is split by look-ahead and both extensions are added to 
+  the deque of the thread that was solving it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec_CncMan_t_ Cec_CncMan_t;
+struct Cec_CncMan_t_
+{
+    Gia_Man_t *     p;                      // the miter (read-only)
+    Cnf_Dat_t *     pCnf;                   // the miter's CNF (read-only)
+    int             nProcs;                 // the number of threads
+    int             nTimeOut;               // the runtime limit per cube
+    int             nIterMax;               // the max number of cube splits
+    int             LookAhead;              // look-ahead when splitting
+    int             fVerbose;               // verbose flag
+    Util_Steal_t *  pPool;                  // cubes in the deques or being solved
+    pthread_mutex_t Mutex;                  // protects the shared data below
+    int             RetValue;               // the result
+    int             nSolved;                // the number of solved cubes
+    int             nSplits;                // the number of split cubes
+    double          Progress;               // the fraction of the space refuted
+    Abc_Cex_t *     pCex;                   // the counter-example
+    abctime         clkStart;               // starting time
+};
+typedef struct Cec_CncThData_t_
+{
+    Cec_CncMan_t *  pMan;
+    Gia_Man_t *     pGia;                   // thread-local copy of the miter
+    int             iThread;
+} Cec_CncThData_t;
+
+static inline void Cec_CncLock( pthread_mutex_t * pMutex )   { int status = pthread_mutex_lock(pMutex);   assert( status == 0 ); }
+static inline void Cec_CncUnlock( pthread_mutex_t * pMutex ) { int status = pthread_mutex_unlock(pMutex); assert( status == 0 ); }
+
+void Cec_CncFreeCube( void * pCube )
+{
+    Vec_IntFree( (Vec_Int_t *)pCube );
+}
+void Cec_CncSolveCube( Cec_CncThData_t * pThData, sat_solver * pSat, Vec_Int_t * vCube, Vec_Int_t * vLits )
+{
+    Cec_CncMan_t * p = pThData->pMan;
+    Gia_Man_t * pCof;
+    int i, iLit, iVar, status, nConfs = sat_solver_nconflicts( pSat );
+    // translate the cube into SAT assumptions
+    Vec_IntClear( vLits );
+    Vec_IntForEachEntry( vCube, iLit, i )
+        Vec_IntPush( vLits, Abc_Var2Lit(p->pCnf->pVarNums[Gia_ObjId(p->p, Gia_ManPi(p->p, Abc_Lit2Var(iLit)))], Abc_LitIsCompl(iLit)) );
+    sat_solver_set_runtime_limit( pSat, p->nTimeOut ? p->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
+    status = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    nConfs = sat_solver_nconflicts( pSat ) - nConfs;
+    if ( status == l_True )
+    {
+        Cec_CncLock( &p->Mutex );
+        if ( p->pCex == NULL )
+            p->pCex = Cec_SplitDeriveModel( p->p, p->pCnf, pSat );
+        p->RetValue = 0;
+        p->nSolved++;
+        if ( p->fVerbose )
+            Cec_GiaSplitPrint( pThData->iThread+1, Vec_IntSize(vCube), sat_solver_nvars(pSat), nConfs, 0, p->Progress, Abc_Clock() - p->clkStart );
+        Cec_CncUnlock( &p->Mutex );
+        Util_StealSetStop( p->pPool );
+        Util_StealFinish( p->pPool );
+        return;
+    }
+    if ( status == l_False )
+    {
+        Cec_CncLock( &p->Mutex );
+        p->Progress += 1.0 / pow((double)2, (double)Vec_IntSize(vCube));
+        p->nSolved++;
+        if ( p->fVerbose )
+            Cec_GiaSplitPrint( pThData->iThread+1, Vec_IntSize(vCube), sat_solver_nvars(pSat), nConfs, 1, p->Progress, Abc_Clock() - p->clkStart );
+        Cec_CncUnlock( &p->Mutex );
+        Util_StealFinish( p->pPool );
+        return;
+    }
+    // the cube is undecided - extend it by one more variable
+    pCof = Cec_GiaCubeCofactor( pThData->pGia, vCube );
+    iVar = Cec_GiaCubeSplitVar( pCof, vCube, p->LookAhead );
+    Gia_ManStop( pCof );
+    Cec_CncLock( &p->Mutex );
+    if ( p->fVerbose )
+        Cec_GiaSplitPrint( pThData->iThread+1, Vec_IntSize(vCube), sat_solver_nvars(pSat), nConfs, -1, p->Progress, Abc_Clock() - p->clkStart );
+    if ( iVar == -1 || (p->nIterMax && p->nSplits >= p->nIterMax) )
+    {
+        // cannot split further - the problem remains undecided
+        // (the cube is left pending, so that the result is not UNSAT)
+        Cec_CncUnlock( &p->Mutex );
+        Util_StealSetStop( p->pPool );
+        return;
+    }
+    p->nSplits++;
+    Cec_CncUnlock( &p->Mutex );
+    // add both extensions before finishing the cube to keep it pending
+    Vec_IntPush( vCube, Abc_Var2Lit(iVar, 1) );
+    Util_StealAdd( p->pPool, pThData->iThread, Vec_IntDup(vCube) );
+    Vec_IntWriteEntry( vCube, Vec_IntSize(vCube)-1, Abc_Var2Lit(iVar, 0) );
+    Util_StealAdd( p->pPool, pThData->iThread, Vec_IntDup(vCube) );
+    Util_StealFinish( p->pPool );
+}
+void * Cec_GiaCubeWorkerThread( void * pArg )
+{
+    Cec_CncThData_t * pThData = (Cec_CncThData_t *)pArg;
+    Cec_CncMan_t * p = pThData->pMan;
+    sat_solver * pSat = Cec_GiaDeriveSolver( p->p, p->pCnf, 0 );
+    Vec_Int_t * vLits = Vec_IntAlloc( 100 );
+    Vec_Int_t * vCube;
+    while ( (vCube = (Vec_Int_t *)Util_StealFetch( p->pPool, pThData->iThread )) != NULL )
+    {
+        if ( pSat == NULL ) // the miter is UNSAT without assumptions
+        {
+            Cec_CncLock( &p->Mutex );
+            p->Progress += 1.0 / pow((double)2, (double)Vec_IntSize(vCube));
+            p->nSolved++;
+            Cec_CncUnlock( &p->Mutex );
+            Util_StealFinish( p->pPool );
+        }
+        else
+            Cec_CncSolveCube( pThData, pSat, vCube, vLits );
+        Vec_IntFree( vCube );
+    }
+    if ( pSat )
+        sat_solver_delete( pSat );
+    Vec_IntFree( vLits );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+int Cec_GiaCubeTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nCubeDepth, int fVerbose, int fVeryVerbose, int fSilent )
+{
+    Cec_CncMan_t Man, * pMan = &Man;
+    Cec_CncThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Vec_Ptr_t * vCubes;
+    Vec_Int_t * vCube;
+    int i, status, nSatVars, nSatConfs, nCubes, nSteals;
+    Abc_CexFreeP( &p->pCexComb );
+    if ( fVerbose )
+        printf( "Solving CEC problem by cube-and-conquer with the following parameters:\n" );
+    if ( fVerbose )
+        printf( "Threads = %d   TimeOut = %d sec   MaxIter = %d   LookAhead = %d   CubeDepth = %d   Verbose = %d.\n", nProcs, nTimeOut, nIterMax, LookAhead, nCubeDepth, fVerbose );
+    fflush( stdout );
+    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
+    memset( pMan, 0, sizeof(Cec_CncMan_t) );
+    pMan->p         = p;
+    pMan->nProcs    = nProcs;
+    pMan->nTimeOut  = nTimeOut;
+    pMan->nIterMax  = nIterMax;
+    pMan->LookAhead = LookAhead;
+    pMan->fVerbose  = fVerbose;
+    pMan->RetValue  = -1;
+    pMan->clkStart  = Abc_Clock();
+    // check the problem
+    pMan->pCnf = Cec_GiaDeriveGiaRemapped( p );
+    status = Cnf_GiaSolveOne( p, pMan->pCnf, nTimeOut, &nSatVars, &nSatConfs );
+    if ( fVerbose && status != -1 )
+        Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, 0, Abc_Clock() - pMan->clkStart );
+    if ( status != -1 )
+    {
+        Cnf_DataFree( pMan->pCnf );
+        if ( !fSilent )
+            printf( "The problem is %s without cofactoring.\n", status ? "UNSAT" : "SAT" );
+        return status;
+    }
+    // generate the cubes and distribute them among the threads
+    vCubes = Cec_GiaCubeGenerate( p, nCubeDepth, LookAhead, &pMan->Progress );
+    nCubes = Vec_PtrSize( vCubes );
+    if ( fVerbose )
+    {
+        printf( "Look-ahead cuber produced %d cubes of depth up to %d (%.4f %% refuted by cofactoring).  ", nCubes, nCubeDepth, 100*pMan->Progress );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - pMan->clkStart );
+    }
+    pMan->pPool = Util_StealStart( nProcs );
+    status = pthread_mutex_init( &pMan->Mutex, NULL );  assert( status == 0 );
+    Vec_PtrForEachEntry( Vec_Int_t *, vCubes, vCube, i )
+        Util_StealAdd( pMan->pPool, i % nProcs, vCube );
+    Vec_PtrFree( vCubes );
+    // start the threads and wait till they finish
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pMan    = pMan;
+        ThData[i].pGia    = Gia_ManDup( p );
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaCubeWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        Gia_ManStop( ThData[i].pGia );
+    }
+    if ( pMan->RetValue == -1 && Util_StealPendingNum(pMan->pPool) == 0 )
+        pMan->RetValue = 1;
+    nSteals = Util_StealStealNum( pMan->pPool );
+    p->pCexComb = pMan->pCex;
+    // cleanup
+    Util_StealStop( pMan->pPool, Cec_CncFreeCube );
+    pthread_mutex_destroy( &pMan->Mutex );
+    Cnf_DataFree( pMan->pCnf );
+    if ( !fSilent )
+    {
+        if ( pMan->RetValue == 0 )
+            printf( "Problem is SAT " );
+        else if ( pMan->RetValue == 1 )
+            printf( "Problem is UNSAT " );
+        else if ( pMan->RetValue == -1 )
+            printf( "Problem is UNDECIDED " );
+        else assert( 0 );
+        printf( "after %d cubes (%d initial, %d splits, %d steals).  ", pMan->nSolved, nCubes, pMan->nSplits, nSteals );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - pMan->clkStart );
+        fflush( stdout );
+    }
+    return pMan->RetValue;
+}
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nCubeDepth, int fVerbose, int fVeryVerbose, int fSilent )
 {
     Abc_Cex_t * pCex = NULL;
     Gia_Man_t * pOne;
@@ -749,8 +1074,10 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
         pOne = Gia_ManDupOutputGroup( p, i, i+1 );
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
-        RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
-        Gia_ManStop( pOne );
+        if ( nCubeDepth > 0 )
+            RetValue1 = Cec_GiaCubeTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead, nCubeDepth, fVerbose, fVeryVerbose, fSilent );
+        else
+            RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
         {
@@ -758,6 +1085,7 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
             pCex->iPo = i;
             RetValue = 0;
         }
+        Gia_ManStop( pOne );
         if ( RetValue1 == -1 )
             fOneUndef = 1;
     }
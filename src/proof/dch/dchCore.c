@@ -54,6 +54,7 @@ void Dch_ManSetDefaultParams( Dch_Pars_t * p )
     p->fPower         =     0;  // power-aware rewriting
     p->fLightSynth    =     0;  // uses lighter version of synthesis
     p->fSkipRedSupp   =     0;  // skips choices with redundant structural support
+    p->nProcs         =     1;  // the number of threads
     p->fVerbose       =     0;  // verbose stats
     p->nNodesAhead    =  1000;  // the lookahead in terms of nodes
     p->nCallsRecycle  =   100;  // calls to perform before recycling SAT solver
@@ -62,6 +62,7 @@ struct Inter_ManParams_t_
     int  fUseBackward;  // perform backward interpolation
     int  fUseSeparate;  // solve each output separately
     int  fUseTwoFrames; // create the OR of two last timeframes
+    int  fUseIncr;      // reuse one solver with activation literals across steps
     int  fDropSatOuts;  // replace by 1 the solved outputs
     int  fDropInvar;    // dump inductive invariant into file
     int  fVerbose;      // print verbose statistics
@@ -60,6 +60,7 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fUseBackward  = 0;     // perform backward interpolation
     p->fUseSeparate  = 0;     // solve each output separately
     p->fUseTwoFrames = 0;     // create OR of two last timeframes
+    p->fUseIncr      = 0;     // reuse one solver with activation literals across steps
     p->fDropSatOuts  = 0;     // replace by 1 the solved outputs
     p->fVerbose      = 0;     // print verbose statistics
     p->iFrameMax     =-1;
@@ -216,6 +217,9 @@ p->timeEqu += Abc_Clock() - clk;
             }
             else 
 #endif
+            if ( pPars->fUseIncr && !pPars->fUseBackward )
+                RetValue = Inter_ManPerformOneStepIncr( p, nTimeNewOut );
+            else
                 RetValue = Inter_ManPerformOneStep( p, pPars->fUseBias, pPars->fUseBackward, nTimeNewOut );
 
             if ( pPars->fVerbose )
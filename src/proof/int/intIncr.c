@@ -0,0 +1,269 @@
+/**CFile****************************************************************
+
+  FileName    [intIncr.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Interpolation with one SAT solver kept across the steps.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: intIncr.c,v 1.00 2026/10/19 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "intInt.h"
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one clause guarded by the activation variable.]
+
+  Description [Every clause gets an activation literal, so that no clause
+  becomes unit (or is simplified) when it is added. This way the partial
+  interpolants are always derived using the final partition of clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Inter_ManIncrAddClause( sat_solver2 * pSat, int * pBeg, int * pEnd, int nVarShift, int iVarAct, int fPartA, Vec_Int_t * vLits )
+{
+    int * pLit, Cid;
+    Vec_IntClear( vLits );
+    for ( pLit = pBeg; pLit < pEnd; pLit++ )
+        Vec_IntPush( vLits, *pLit + 2 * nVarShift );
+    Vec_IntPush( vLits, toLitCond(iVarAct, 1) );
+    Cid = sat_solver2_addclause( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), -1 );
+    if ( fPartA )
+        clause2_set_partA( pSat, Cid, 1 );
+}
+static void Inter_ManIncrAddBuffer( sat_solver2 * pSat, int iVar0, int iVar1, int iVarAct, int fPartA, Vec_Int_t * vLits )
+{
+    int Lits[2];
+    Lits[0] = toLitCond( iVar0, 0 );
+    Lits[1] = toLitCond( iVar1, 1 );
+    Inter_ManIncrAddClause( pSat, Lits, Lits + 2, 0, iVarAct, fPartA, vLits );
+    Lits[0] = toLitCond( iVar0, 1 );
+    Lits[1] = toLitCond( iVar1, 0 );
+    Inter_ManIncrAddClause( pSat, Lits, Lits + 2, 0, iVarAct, fPartA, vLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the incremental solver.]
+
+  Description [Variables of the timeframes (B) come first, followed by
+  the variables of one timeframe (A) and the two activation variables.
+  The interpolants are added later, each with its own activation variable.
+  The global variables are the register inputs of the timeframes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static sat_solver2 * Inter_ManIncrStart( Inter_Man_t * p )
+{
+    Aig_Man_t * pAig = p->pAigTrans;
+    Cnf_Dat_t * pCnfAig = p->pCnfAig;
+    Cnf_Dat_t * pCnfFrames = p->pCnfFrames;
+    sat_solver2 * pSat;
+    Aig_Obj_t * pObj, * pObj2;
+    Vec_Int_t * vLits;
+    int i, nVarsFrames = pCnfFrames->nVars;
+    assert( Aig_ManRegNum(p->pFrames) == 0 );
+    assert( Aig_ManCoNum(p->pFrames) == 1 );
+    p->iActTrans  = nVarsFrames + pCnfAig->nVars;
+    p->iActFrames = p->iActTrans + 1;
+    p->iActInter  = -1;
+    // start the solver
+    pSat = sat_solver2_new();
+    sat_solver2_setnvars( pSat, p->iActFrames + 1 );
+    for ( i = nVarsFrames; i <= p->iActTrans; i++ )
+        var_set_partA( pSat, i, 1 );
+    vLits = Vec_IntAlloc( 100 );
+    // add clauses of A: one timeframe
+    for ( i = 0; i < pCnfAig->nClauses; i++ )
+        Inter_ManIncrAddClause( pSat, pCnfAig->pClauses[i], pCnfAig->pClauses[i+1], nVarsFrames, p->iActTrans, 1, vLits );
+    // connector clauses
+    Vec_IntClear( p->vVarsAB );
+    Aig_ManForEachCi( p->pFrames, pObj, i )
+    {
+        if ( i == Aig_ManRegNum(pAig) )
+            break;
+        Vec_IntPush( p->vVarsAB, pCnfFrames->pVarNums[pObj->Id] );
+        pObj2 = Saig_ManLi( pAig, i );
+        Inter_ManIncrAddBuffer( pSat, pCnfFrames->pVarNums[pObj->Id], nVarsFrames + pCnfAig->pVarNums[pObj2->Id], p->iActTrans, 1, vLits );
+    }
+    // add clauses of B
+    for ( i = 0; i < pCnfFrames->nClauses; i++ )
+        Inter_ManIncrAddClause( pSat, pCnfFrames->pClauses[i], pCnfFrames->pClauses[i+1], 0, p->iActFrames, 0, vLits );
+    Vec_IntFree( vLits );
+    // interpolants are derived on the fly while the proof is generated
+    pSat->pInt2 = Int2_ManStart( pSat, Vec_IntArray(p->vVarsAB), Vec_IntSize(p->vVarsAB) );
+    p->nClaIncrBase  = sat_solver2_nclauses( pSat );
+    p->nClaIncrLast  = 0;
+    p->nClaIncrStale = 0;
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the incremental solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Inter_ManIncrStop( Inter_Man_t * p )
+{
+    if ( p->pSatIncr == NULL )
+        return;
+    sat_solver2_delete( p->pSatIncr );
+    p->pSatIncr  = NULL;
+    p->iActInter = -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the current interpolant under a new activation variable.]
+
+  Description [Disables the previous interpolant.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Inter_ManIncrAddInter( Inter_Man_t * p )
+{
+    sat_solver2 * pSat = p->pSatIncr;
+    Cnf_Dat_t * pCnfInter = p->pCnfInter;
+    Aig_Obj_t * pObj, * pObj2;
+    Vec_Int_t * vLits;
+    int i, Lit, Cid, iVarAct, nVarsOld = sat_solver2_nvars( pSat );
+    assert( Aig_ManCoNum(p->pInter) == 1 );
+    assert( Aig_ManCiNum(p->pInter) == Aig_ManRegNum(p->pAigTrans) );
+    // disable the previous interpolant
+    if ( p->iActInter >= 0 )
+    {
+        Lit = toLitCond( p->iActInter, 1 );
+        Cid = sat_solver2_addclause( pSat, &Lit, &Lit + 1, -1 );
+        clause2_set_partA( pSat, Cid, 1 );
+        p->nClaIncrStale += p->nClaIncrLast + 1;
+    }
+    // the new variables belong to A
+    iVarAct = p->iActInter = nVarsOld;
+    sat_solver2_setnvars( pSat, nVarsOld + 1 + pCnfInter->nVars );
+    for ( i = nVarsOld; i < sat_solver2_nvars(pSat); i++ )
+        var_set_partA( pSat, i, 1 );
+    vLits = Vec_IntAlloc( 100 );
+    for ( i = 0; i < pCnfInter->nClauses; i++ )
+        Inter_ManIncrAddClause( pSat, pCnfInter->pClauses[i], pCnfInter->pClauses[i+1], nVarsOld + 1, iVarAct, 1, vLits );
+    // connect the interpolant with the register outputs of one timeframe
+    Aig_ManForEachCi( p->pInter, pObj, i )
+    {
+        pObj2 = Saig_ManLo( p->pAigTrans, i );
+        Inter_ManIncrAddBuffer( pSat, nVarsOld + 1 + pCnfInter->pVarNums[pObj->Id], p->pCnfFrames->nVars + p->pCnfAig->pVarNums[pObj2->Id], iVarAct, 1, vLits );
+    }
+    Vec_IntFree( vLits );
+    p->nClaIncrLast = sat_solver2_nclauses( pSat ) - p->nClaIncrBase - p->nClaIncrStale;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one SAT run with interpolation using the incremental solver.]
+
+  Description [The timeframes and the transition relation are loaded once
+  for each unrolling depth. The interpolant of each step is added under
+  a fresh activation literal and disabled by a unit clause in the next step.
+  The interpolant is computed from the proof while the solver runs, as
+  an AIG with structural hashing. The solver is restarted when disabled
+  interpolants or the proof AIG dominate, which keeps memory bounded.
+  Returns 1 if proven. 0 if failed. -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformOneStepIncr( Inter_Man_t * p, abctime nTimeNewOut )
+{
+    Gia_Man_t * pInterGia;
+    int Lits[3], nConfStart, status;
+    abctime clk;
+    // restart the solver if too much of it is left from the previous steps
+    if ( p->pSatIncr && (p->nClaIncrStale > p->nClaIncrBase || Int2_ManReadObjNum(p->pSatIncr) > Abc_MaxInt(1 << 20, 8 * p->nClaIncrBase)) )
+    {
+        if ( p->fVerbose )
+            printf( "Restarting the incremental solver (%d disabled clauses, %d proof nodes).\n",
+                p->nClaIncrStale, Int2_ManReadObjNum(p->pSatIncr) );
+        Inter_ManIncrStop( p );
+    }
+    if ( p->pSatIncr == NULL )
+        p->pSatIncr = Inter_ManIncrStart( p );
+    Inter_ManIncrAddInter( p );
+
+    // set runtime limit
+    if ( nTimeNewOut )
+        sat_solver2_set_runtime_limit( p->pSatIncr, nTimeNewOut );
+
+    // solve the problem
+clk = Abc_Clock();
+    Lits[0] = toLitCond( p->iActTrans, 0 );
+    Lits[1] = toLitCond( p->iActFrames, 0 );
+    Lits[2] = toLitCond( p->iActInter, 0 );
+    nConfStart = sat_solver2_nconflicts( p->pSatIncr );
+    status = sat_solver2_solve( p->pSatIncr, Lits, Lits + 3, (ABC_INT64_T)p->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    p->nConfCur = sat_solver2_nconflicts( p->pSatIncr ) - nConfStart;
+p->timeSat += Abc_Clock() - clk;
+    if ( status == l_True )
+        return 0;
+    if ( status != l_False )
+        return -1;
+
+    // create the resulting manager
+clk = Abc_Clock();
+    pInterGia = (Gia_Man_t *)Int2_ManDupInterpolant( p->pSatIncr );
+    if ( pInterGia == NULL )
+    {
+        // the proof is not available; recompute the interpolant from scratch
+        Inter_ManIncrStop( p );
+        return Inter_ManPerformOneStep( p, 0, 0, nTimeNewOut );
+    }
+    p->pInterNew = Gia_ManToAigSimple( pInterGia );
+    Gia_ManStop( pInterGia );
+p->timeInt += Abc_Clock() - clk;
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -29,6 +29,7 @@
 #include "aig/saig/saig.h"
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
+#include "sat/bsat/satSolver2.h"
 #include "sat/bsat/satStore.h"
 #include "int.h"
 
@@ -64,6 +65,14 @@ struct Inter_Man_t_
     // temporary place for the new interpolant
     Aig_Man_t *      pInterNew;
     Vec_Ptr_t *      vInters;
+    // incremental solver
+    sat_solver2 *    pSatIncr;     // the solver reused across interpolation steps
+    int              iActTrans;    // activation variable of the transition relation
+    int              iActFrames;   // activation variable of the timeframes
+    int              iActInter;    // activation variable of the current interpolant
+    int              nClaIncrBase; // the number of clauses without interpolants
+    int              nClaIncrLast; // the number of clauses of the current interpolant
+    int              nClaIncrStale;// the number of clauses of disabled interpolants
     // parameters
     int              nFrames;      // the number of timeframes
     int              nConfCur;     // the current number of conflicts
@@ -117,6 +126,10 @@ extern Inter_Man_t *   Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pP
 extern void            Inter_ManClean( Inter_Man_t * p );
 extern void            Inter_ManStop( Inter_Man_t * p, int fProved );
 
+/*=== intIncr.c ============================================================*/
+extern void            Inter_ManIncrStop( Inter_Man_t * p );
+extern int             Inter_ManPerformOneStepIncr( Inter_Man_t * p, abctime nTimeNewOut );
+
 /*=== intM114.c ============================================================*/
 extern int             Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, int fUseBackward, abctime nTimeNewOut );
 
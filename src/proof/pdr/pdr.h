@@ -50,6 +50,7 @@ struct Pdr_Par_t_
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
     int nRandomSeed;      // value to seed the SAT solver with
+    int nThreads;         // the number of worker threads
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
     int fNewXSim;         // updated X-valued simulation
@@ -66,6 +67,7 @@ struct Pdr_Par_t_
     int fCtgs;            // handle CTGs in down
     int fUseAbs;          // use abstraction 
     int fUseSimpleRef;    // simplified CEX refinement
+    int fInprocess;       // inprocessing of learned clauses in the SAT solvers
     int fVerbose;         // verbose output`
     int fVeryVerbose;     // very verbose output
     int fNotVerbose;      // not printing line by line progress
@@ -84,6 +86,7 @@ struct Pdr_Par_t_
     abctime timeLastSolved; // the time when the last output was solved
     Vec_Int_t * vOutMap;  // in the multi-output mode, contains status for each PO (0 = sat; 1 = unsat; negative = undecided)
     char * pInvFileName;  // invariable file name
+    char * pLemFileName;  // lemma database file name
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -439,6 +439,9 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
 sat_solver * Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit )
 {
     assert( pSat != NULL );
+    // variables are not eliminated because the CNF is loaded on demand
+    if ( p->pPars->fInprocess )
+        sat_solver_set_inprocess( pSat, SAT_INPROC_LEARNT );
     if ( p->pPars->fMonoCnf )
         return Pdr_ManNewSolver1( pSat, p, k, fInit );
     else
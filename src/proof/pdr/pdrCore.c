@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nThreads       =       1;  // the number of worker threads
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -80,6 +81,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nDropOuts      =       0;  // the number of timed out outputs
     pPars->timeLastSolved =       0;  // last one solved
     pPars->pInvFileName   =    NULL;  // invariant file name
+    pPars->pLemFileName   =    NULL;  // lemma database file name
 }
 
 /**Function*************************************************************
@@ -1281,6 +1283,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         assert( pCube == NULL );
         Pdr_ManSetPropertyOutput( p, iFrame );
         Pdr_ManCreateSolver( p, ++iFrame );
+        if ( iFrame == 1 && p->vLemWarm )
+            Pdr_ManLemmasAddWarm( p );
         if ( fPrintClauses )
         {
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
@@ -1413,8 +1417,18 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
+    if ( pPars->nThreads > 1 && (pPars->fSolveAll || pPars->fUseAbs || pPars->nTimeOutOne || pPars->fUseBridge) )
+    {
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Multi-threaded PDR does not support this mode; using one thread.\n" );
+        pPars->nThreads = 1;
+    }
     p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    if ( pPars->pLemFileName )
+        Pdr_ManLemmasLoad( p, pPars->pLemFileName );
+    RetValue = pPars->nThreads > 1 ? Pdr_ManSolvePth( p ) : Pdr_ManSolveInt( p );
+    if ( pPars->pLemFileName )
+        Pdr_ManLemmasSave( p, pPars->pLemFileName );
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -0,0 +1,546 @@
+/**CFile****************************************************************
+
+  FileName    [pdrLem.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Saving and loading the PDR lemmas to warm-start later runs.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: pdrLem.c,v 1.00 2026/10/19 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The database is a byte stream written with Vec_StrPut*():
+//   magic "PDRL", version, nFlops, nFlops structural hashes (8 bytes each),
+//   nCubes, and for each cube: frame, nLits, the first literal followed
+//   by the differences of the sorted literals (variable-length integers).
+// A literal is 2*Flop+fCompl, the same as in Pdr_Set_t.
+
+#define PDR_LEM_VERSION  1   // version of the database format
+#define PDR_LEM_ROUNDS   4   // rounds of flop hash propagation
+
+typedef struct Pdr_LemKey_t_ Pdr_LemKey_t;
+struct Pdr_LemKey_t_
+{
+    word             Hash;   // structural hash of the flop
+    int              iFlop;  // flop index
+};
+
+static inline word Pdr_LemHashMix( word x )
+{
+    x ^= x >> 33;
+    x *= ABC_CONST(0xff51afd7ed558ccd);
+    x ^= x >> 33;
+    x *= ABC_CONST(0xc4ceb9fe1a85ec53);
+    x ^= x >> 33;
+    return x;
+}
+static inline word Pdr_LemHashLit( word * pHash, Aig_Obj_t * pObj, int fCompl )
+{
+    return Pdr_LemHashMix( pHash[Aig_ObjId(pObj)] + (fCompl ? ABC_CONST(0x9e3779b97f4a7c15) : 0) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes structural hashes of the flops.]
+
+  Description [Flops start with the same hash. In each round, the hashes
+  of the nodes are recomputed from the fanins and each flop gets the hash
+  of its next-state function. The hashes do not depend on the order of
+  the flops, so they remain stable when flops are added or reordered.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t * Pdr_ManLemmasFlopHashes( Aig_Man_t * p )
+{
+    Vec_Wrd_t * vHashes;
+    Aig_Obj_t * pObj, * pObjLi, * pObjLo;
+    word * pHash = ABC_CALLOC( word, Aig_ManObjNumMax(p) );
+    word * pNext = ABC_CALLOC( word, Aig_ManRegNum(p) );
+    word Hash0, Hash1;
+    int i, r;
+    pHash[Aig_ObjId(Aig_ManConst1(p))] = Pdr_LemHashMix( 1 );
+    Saig_ManForEachPi( p, pObj, i )
+        pHash[Aig_ObjId(pObj)] = Pdr_LemHashMix( 2 + i );
+    Saig_ManForEachLo( p, pObj, i )
+        pHash[Aig_ObjId(pObj)] = Pdr_LemHashMix( 0 );
+    for ( r = 0; r < PDR_LEM_ROUNDS; r++ )
+    {
+        Aig_ManForEachNode( p, pObj, i )
+        {
+            Hash0 = Pdr_LemHashLit( pHash, Aig_ObjFanin0(pObj), Aig_ObjFaninC0(pObj) );
+            Hash1 = Pdr_LemHashLit( pHash, Aig_ObjFanin1(pObj), Aig_ObjFaninC1(pObj) );
+            pHash[Aig_ObjId(pObj)] = Pdr_LemHashMix( Abc_MinWord(Hash0, Hash1) ^ Pdr_LemHashMix(Abc_MaxWord(Hash0, Hash1)) );
+        }
+        Saig_ManForEachLiLo( p, pObjLi, pObjLo, i )
+            pNext[i] = Pdr_LemHashMix( pHash[Aig_ObjId(pObjLo)] ^ Pdr_LemHashLit(pHash, Aig_ObjFanin0(pObjLi), Aig_ObjFaninC0(pObjLi)) );
+        Saig_ManForEachLo( p, pObj, i )
+            pHash[Aig_ObjId(pObj)] = pNext[i];
+    }
+    vHashes = Vec_WrdAlloc( Aig_ManRegNum(p) );
+    Saig_ManForEachLo( p, pObj, i )
+        Vec_WrdPush( vHashes, pHash[Aig_ObjId(pObj)] );
+    ABC_FREE( pHash );
+    ABC_FREE( pNext );
+    return vHashes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the flops of the database into the flops of the design.]
+
+  Description [Only the flops whose hashes are unique on both sides are
+  mapped. Returns the array mapping database flops into design flops
+  (or -1).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_LemKeyCompare( Pdr_LemKey_t * p1, Pdr_LemKey_t * p2 )
+{
+    if ( p1->Hash < p2->Hash )
+        return -1;
+    if ( p1->Hash > p2->Hash )
+        return 1;
+    return p1->iFlop - p2->iFlop;
+}
+static Pdr_LemKey_t * Pdr_LemKeysSorted( Vec_Wrd_t * vHashes )
+{
+    Pdr_LemKey_t * pKeys = ABC_ALLOC( Pdr_LemKey_t, Vec_WrdSize(vHashes) + 1 );
+    word Hash; int i;
+    Vec_WrdForEachEntry( vHashes, Hash, i )
+        pKeys[i].Hash = Hash, pKeys[i].iFlop = i;
+    qsort( (void *)pKeys, (size_t)Vec_WrdSize(vHashes), sizeof(Pdr_LemKey_t), (int (*)(const void *, const void *))Pdr_LemKeyCompare );
+    return pKeys;
+}
+static inline int Pdr_LemKeyIsUnique( Pdr_LemKey_t * pKeys, int nKeys, int i )
+{
+    return (i == 0 || pKeys[i-1].Hash != pKeys[i].Hash) && (i == nKeys-1 || pKeys[i+1].Hash != pKeys[i].Hash);
+}
+Vec_Int_t * Pdr_ManLemmasMapFlops( Vec_Wrd_t * vHashesOld, Vec_Wrd_t * vHashesNew )
+{
+    Vec_Int_t * vMap = Vec_IntStartFull( Vec_WrdSize(vHashesOld) );
+    int nOld = Vec_WrdSize(vHashesOld), nNew = Vec_WrdSize(vHashesNew);
+    Pdr_LemKey_t * pOld = Pdr_LemKeysSorted( vHashesOld );
+    Pdr_LemKey_t * pNew = Pdr_LemKeysSorted( vHashesNew );
+    int i = 0, k = 0;
+    while ( i < nOld && k < nNew )
+    {
+        if ( pOld[i].Hash < pNew[k].Hash )
+            i++;
+        else if ( pOld[i].Hash > pNew[k].Hash )
+            k++;
+        else
+        {
+            if ( Pdr_LemKeyIsUnique(pOld, nOld, i) && Pdr_LemKeyIsUnique(pNew, nNew, k) )
+                Vec_IntWriteEntry( vMap, pOld[i].iFlop, pNew[k].iFlop );
+            i++, k++;
+        }
+    }
+    ABC_FREE( pOld );
+    ABC_FREE( pNew );
+    return vMap;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the lemmas of all frames into the database.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManLemmasSave( Pdr_Man_t * p, char * pFileName )
+{
+    Vec_Str_t * vOut;
+    Vec_Wrd_t * vHashes;
+    Vec_Ptr_t * vArrayK;
+    Pdr_Set_t * pCube;
+    FILE * pFile;
+    word Hash;
+    int i, k, m, nCubes = 0;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open lemma database \"%s\" for writing.\n", pFileName );
+        return 0;
+    }
+    vOut = Vec_StrAlloc( 1000 );
+    Vec_StrPutS( vOut, (char *)"PDRL" );
+    Vec_StrPutI( vOut, PDR_LEM_VERSION );
+    Vec_StrPutI( vOut, Aig_ManRegNum(p->pAig) );
+    vHashes = Pdr_ManLemmasFlopHashes( p->pAig );
+    Vec_WrdForEachEntry( vHashes, Hash, i )
+        Vec_StrPutW( vOut, Hash );
+    Vec_WrdFree( vHashes );
+    Vec_VecForEachLevelStart( p->vClauses, vArrayK, k, 1 )
+        nCubes += Vec_PtrSize(vArrayK);
+    Vec_StrPutI( vOut, nCubes );
+    Vec_VecForEachLevelStart( p->vClauses, vArrayK, k, 1 )
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, i )
+        {
+            Vec_StrPutI( vOut, k );
+            Vec_StrPutI( vOut, pCube->nLits );
+            for ( m = 0; m < pCube->nLits; m++ )
+                Vec_StrPutI( vOut, m ? pCube->Lits[m] - pCube->Lits[m-1] : pCube->Lits[m] );
+        }
+    fwrite( Vec_StrArray(vOut), 1, (size_t)Vec_StrSize(vOut), pFile );
+    fclose( pFile );
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Saved %d lemmas over %d flops into database \"%s\" (%d bytes).\n",
+            nCubes, Aig_ManRegNum(p->pAig), pFileName, Vec_StrSize(vOut) );
+    Vec_StrFree( vOut );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads numbers from the database without running past its end.]
+
+  Description [Return 0 if the stream ends before the number is complete.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Pdr_ManLemmasGetI( Vec_Str_t * vIn, int * pPos, int * pVal )
+{
+    unsigned Val = 0;
+    int i, ch;
+    for ( i = 0; i < 5 && *pPos < Vec_StrSize(vIn); i++ )
+    {
+        ch = (unsigned char)Vec_StrEntry( vIn, (*pPos)++ );
+        Val |= (unsigned)(ch & 0x7f) << (7 * i);
+        if ( !(ch & 0x80) )
+        {
+            *pVal = (int)Val;
+            return 1;
+        }
+    }
+    return 0;
+}
+static inline int Pdr_ManLemmasGetW( Vec_Str_t * vIn, int * pPos, word * pVal )
+{
+    if ( *pPos + 8 > Vec_StrSize(vIn) )
+        return 0;
+    *pVal = Vec_StrGetW( vIn, pPos );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the lemmas from the database in terms of the design flops.]
+
+  Description [Lemmas with unmapped flops or containing the initial state
+  are skipped. Returns NULL if the file cannot be read or is corrupted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Pdr_ManLemmasRead( Pdr_Man_t * p, char * pFileName, int * pnCubesAll )
+{
+    Vec_Ptr_t * vCubes = NULL;
+    Vec_Wrd_t * vHashes = NULL, * vHashesNew;
+    Vec_Int_t * vMap = NULL, * vLits = NULL, * vPiLits = NULL;
+    Vec_Str_t * vIn;
+    FILE * pFile;
+    word Hash;
+    int i, k, m, Lit, Diff, Frame, nSize, nFlops, nCubes, nLits, Version, iPos = 5;
+    *pnCubesAll = 0;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    nSize = Extra_FileSize( pFileName );
+    vIn = Vec_StrStart( nSize );
+    nSize = (int)fread( Vec_StrArray(vIn), 1, (size_t)nSize, pFile );
+    fclose( pFile );
+    Vec_StrShrink( vIn, nSize );
+    if ( nSize < 6 || memcmp(Vec_StrArray(vIn), "PDRL", 5) || !Pdr_ManLemmasGetI(vIn, &iPos, &Version) || Version != PDR_LEM_VERSION )
+        goto finish;
+    // each flop hash takes 8 bytes
+    if ( !Pdr_ManLemmasGetI(vIn, &iPos, &nFlops) || nFlops < 0 || nFlops > (Vec_StrSize(vIn) - iPos) / 8 )
+        goto finish;
+    vHashes = Vec_WrdAlloc( nFlops );
+    for ( i = 0; i < nFlops; i++ )
+    {
+        if ( !Pdr_ManLemmasGetW(vIn, &iPos, &Hash) )
+            goto finish;
+        Vec_WrdPush( vHashes, Hash );
+    }
+    vHashesNew = Pdr_ManLemmasFlopHashes( p->pAig );
+    vMap = Pdr_ManLemmasMapFlops( vHashes, vHashesNew );
+    Vec_WrdFree( vHashesNew );
+    // each cube takes at least 2 bytes
+    if ( !Pdr_ManLemmasGetI(vIn, &iPos, &nCubes) || nCubes < 0 || nCubes > (Vec_StrSize(vIn) - iPos) / 2 )
+        goto finish;
+    // translate the cubes
+    vCubes  = Vec_PtrAlloc( 100 );
+    vLits   = Vec_IntAlloc( 100 );
+    vPiLits = Vec_IntAlloc( 0 );
+    for ( i = 0; i < nCubes; i++ )
+    {
+        // each literal takes at least 1 byte
+        if ( !Pdr_ManLemmasGetI(vIn, &iPos, &Frame) || !Pdr_ManLemmasGetI(vIn, &iPos, &nLits) || nLits < 0 || nLits > Vec_StrSize(vIn) - iPos )
+            goto finish;
+        Vec_IntClear( vLits );
+        for ( k = Lit = 0; k < nLits; k++ )
+        {
+            if ( !Pdr_ManLemmasGetI(vIn, &iPos, &Diff) || Diff < 0 || Lit > ABC_INFINITY - Diff )
+                goto finish;
+            Lit += Diff;
+            m = Abc_Lit2Var(Lit) < nFlops ? Vec_IntEntry( vMap, Abc_Lit2Var(Lit) ) : -1;
+            if ( m >= 0 && Vec_IntSize(vLits) == k )
+                Vec_IntPush( vLits, Abc_Var2Lit(m, Abc_LitIsCompl(Lit)) );
+        }
+        if ( Vec_IntSize(vLits) < nLits ) // some flops are not mapped
+            continue;
+        Vec_PtrPush( vCubes, Pdr_SetCreate(vLits, vPiLits) );
+        if ( Pdr_SetIsInit((Pdr_Set_t *)Vec_PtrEntryLast(vCubes), -1) )
+            Pdr_SetDeref( (Pdr_Set_t *)Vec_PtrPop(vCubes) );
+    }
+    assert( iPos <= Vec_StrSize(vIn) );
+    *pnCubesAll = nCubes;
+    Vec_IntFree( vPiLits );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vMap );
+    Vec_WrdFree( vHashes );
+    Vec_StrFree( vIn );
+    return vCubes;
+finish:
+    Abc_Print( 1, "File \"%s\" is not a PDR lemma database.\n", pFileName );
+    if ( vCubes )
+    {
+        Pdr_Set_t * pCube;
+        Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+            Pdr_SetDeref( pCube );
+        Vec_PtrFree( vCubes );
+    }
+    if ( vPiLits ) Vec_IntFree( vPiLits );
+    if ( vLits )   Vec_IntFree( vLits );
+    if ( vMap )    Vec_IntFree( vMap );
+    if ( vHashes ) Vec_WrdFree( vHashes );
+    Vec_StrFree( vIn );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Keeps the largest subset of the lemmas that is inductive.]
+
+  Description [The lemmas are asserted in the current state, each one
+  under its activation literal, and one SAT call asks whether any of them
+  can fail in the next state. All lemmas failing under the satisfying
+  assignment are dropped at once and the check is repeated until it
+  becomes UNSAT. The remaining lemmas do not contain the initial state
+  and are preserved by the transition relation, so they hold in all
+  reachable states. Returns the number of SAT calls.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManLemmasFilter( Pdr_Man_t * p, Vec_Ptr_t * vCubes )
+{
+    Cnf_Dat_t * pCnf;
+    sat_solver * pSat;
+    Vec_Int_t * vAssump, * vClause;
+    Vec_Int_t * vActs, * vNexts;
+    Aig_Obj_t * pObjLi, * pObjLo;
+    Pdr_Set_t * pCube;
+    int * pVarLo, * pVarLi;
+    int i, k, Lit, RetValue, nVars, nCalls = 0, nAlive = Vec_PtrSize(vCubes);
+    if ( nAlive == 0 )
+        return 0;
+    pCnf   = Cnf_DeriveSimple( p->pAig, Aig_ManCoNum(p->pAig) );
+    pVarLo = ABC_ALLOC( int, Aig_ManRegNum(p->pAig) );
+    pVarLi = ABC_ALLOC( int, Aig_ManRegNum(p->pAig) );
+    Saig_ManForEachLiLo( p->pAig, pObjLi, pObjLo, i )
+    {
+        pVarLo[i] = pCnf->pVarNums[Aig_ObjId(pObjLo)];
+        pVarLi[i] = pCnf->pVarNums[Aig_ObjId(pObjLi)];
+        assert( pVarLo[i] >= 0 && pVarLi[i] >= 0 );
+    }
+    nVars = pCnf->nVars;
+    pSat  = sat_solver_new();
+    sat_solver_setnvars( pSat, nVars + 2 * Vec_PtrSize(vCubes) + 1000 );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        if ( !sat_solver_addclause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1] ) )
+            break;
+    // assert each lemma in the current state and detect its cube in the next state
+    vClause = Vec_IntAlloc( 100 );
+    vActs   = Vec_IntAlloc( Vec_PtrSize(vCubes) );
+    vNexts  = Vec_IntAlloc( Vec_PtrSize(vCubes) );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        int iAct = nVars++, iNext = nVars++;
+        Vec_IntPush( vActs, iAct );
+        Vec_IntPush( vNexts, iNext );
+        Vec_IntFill( vClause, 1, Abc_Var2Lit(iAct, 1) );
+        for ( k = 0; k < pCube->nLits; k++ )
+            Vec_IntPush( vClause, Abc_Var2Lit(pVarLo[Abc_Lit2Var(pCube->Lits[k])], !Abc_LitIsCompl(pCube->Lits[k])) );
+        sat_solver_addclause( pSat, Vec_IntArray(vClause), Vec_IntLimit(vClause) );
+        for ( k = 0; k < pCube->nLits; k++ )
+        {
+            Vec_IntFill( vClause, 1, Abc_Var2Lit(iNext, 1) );
+            Vec_IntPush( vClause, Abc_Var2Lit(pVarLi[Abc_Lit2Var(pCube->Lits[k])], Abc_LitIsCompl(pCube->Lits[k])) );
+            sat_solver_addclause( pSat, Vec_IntArray(vClause), Vec_IntLimit(vClause) );
+        }
+    }
+    // iterate until the remaining lemmas are inductive
+    vAssump = Vec_IntAlloc( Vec_PtrSize(vCubes) + 1 );
+    while ( nAlive > 0 )
+    {
+        int iRound = nVars++;
+        Vec_IntFill( vClause, 1, Abc_Var2Lit(iRound, 1) );
+        Vec_IntFill( vAssump, 1, Abc_Var2Lit(iRound, 0) );
+        Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+            if ( pCube != NULL )
+            {
+                Vec_IntPush( vClause, Abc_Var2Lit(Vec_IntEntry(vNexts, i), 0) );
+                Vec_IntPush( vAssump, Abc_Var2Lit(Vec_IntEntry(vActs, i), 0) );
+            }
+        if ( nVars >= sat_solver_nvars(pSat) )
+            sat_solver_setnvars( pSat, nVars + 1000 );
+        sat_solver_addclause( pSat, Vec_IntArray(vClause), Vec_IntLimit(vClause) );
+        RetValue = sat_solver_solve( pSat, Vec_IntArray(vAssump), Vec_IntLimit(vAssump), 0, 0, 0, 0 );
+        nCalls++;
+        Lit = Abc_Var2Lit( iRound, 1 );
+        sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+        if ( RetValue != l_True )
+            break;
+        // drop the lemmas that fail in the next state
+        Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+        {
+            if ( pCube == NULL )
+                continue;
+            for ( k = 0; k < pCube->nLits; k++ )
+                if ( sat_solver_var_value(pSat, pVarLi[Abc_Lit2Var(pCube->Lits[k])]) == Abc_LitIsCompl(pCube->Lits[k]) )
+                    break;
+            if ( k < pCube->nLits )
+                continue;
+            Pdr_SetDeref( pCube );
+            Vec_PtrWriteEntry( vCubes, i, NULL );
+            nAlive--;
+        }
+    }
+    // compact the remaining lemmas
+    k = 0;
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+        if ( pCube != NULL )
+            Vec_PtrWriteEntry( vCubes, k++, pCube );
+    Vec_PtrShrink( vCubes, k );
+    Vec_IntFree( vAssump );
+    Vec_IntFree( vClause );
+    Vec_IntFree( vActs );
+    Vec_IntFree( vNexts );
+    sat_solver_delete( pSat );
+    Cnf_DataFree( pCnf );
+    ABC_FREE( pVarLo );
+    ABC_FREE( pVarLi );
+    return nCalls;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the lemmas that remain inductive in this design.]
+
+  Description [The lemmas are stored in the manager and added to the
+  first frame when it is created.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManLemmasLoad( Pdr_Man_t * p, char * pFileName )
+{
+    Vec_Ptr_t * vCubes;
+    abctime clk = Abc_Clock();
+    int nCubesAll, nMapped, nCalls;
+    vCubes = Pdr_ManLemmasRead( p, pFileName, &nCubesAll );
+    if ( vCubes == NULL )
+    {
+        if ( p->pPars->fVerbose )
+            Abc_Print( 1, "Lemma database \"%s\" is not available.\n", pFileName );
+        return;
+    }
+    nMapped = Vec_PtrSize(vCubes);
+    nCalls  = Pdr_ManLemmasFilter( p, vCubes );
+    if ( p->pPars->fVerbose )
+    {
+        Abc_Print( 1, "Lemma database: Read = %d.  Mapped = %d.  Inductive = %d.  SAT calls = %d.  ",
+            nCubesAll, nMapped, Vec_PtrSize(vCubes), nCalls );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    if ( Vec_PtrSize(vCubes) == 0 )
+    {
+        Vec_PtrFree( vCubes );
+        return;
+    }
+    assert( p->vLemWarm == NULL );
+    p->vLemWarm = vCubes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the loaded lemmas to the first frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManLemmasAddWarm( Pdr_Man_t * p )
+{
+    Pdr_Set_t * pCube;
+    int i;
+    assert( Vec_PtrSize(p->vSolvers) == 2 );
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vLemWarm, pCube, i )
+    {
+        Vec_VecPush( p->vClauses, 1, pCube ); // consume ref
+        Pdr_ManSolverAddClause( p, 1, pCube );
+    }
+    Vec_PtrFreeP( &p->vLemWarm );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -275,10 +275,11 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->vCiVals  = Vec_IntAlloc( 100 );  // cone leaf values
     p->vCoVals  = Vec_IntAlloc( 100 );  // cone root values
     p->vNodes   = Vec_IntAlloc( 100 );  // cone nodes
-    p->vUndo    = Vec_IntAlloc( 100 );  // cone undos
+    p->vCands   = Vec_IntAlloc( 100 );  // candidate flops to be removed
     p->vVisits  = Vec_IntAlloc( 100 );  // intermediate
     p->vCi2Rem  = Vec_IntAlloc( 100 );  // CIs to be removed
     p->vRes     = Vec_IntAlloc( 100 );  // final result
+    p->vTerSim  = Vec_WrdStart( 2 * Aig_ManObjNumMax(pAig) ); // bit-parallel ternary simulation info
     p->pCnfMan  = Cnf_ManStart();
     // ternary simulation
     p->pTxs3    = pPars->fNewXSim ? Txs3_ManStart( p, pAig, p->vPrio ) : NULL;
@@ -378,11 +379,18 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFree( p->vCiVals   );  // cone leaf values
     Vec_IntFree( p->vCoVals   );  // cone root values
     Vec_IntFree( p->vNodes    );  // cone nodes
-    Vec_IntFree( p->vUndo     );  // cone undos
+    Vec_IntFree( p->vCands    );  // candidate flops to be removed
     Vec_IntFree( p->vVisits   );  // intermediate
     Vec_IntFree( p->vCi2Rem   );  // CIs to be removed
     Vec_IntFree( p->vRes      );  // final result
+    Vec_WrdFree( p->vTerSim   );  // bit-parallel ternary simulation info
     Vec_PtrFreeP( &p->vInfCubes );
+    if ( p->vLemWarm )
+    {
+        Vec_PtrForEachEntry( Pdr_Set_t *, p->vLemWarm, pCla, i )
+            Pdr_SetDeref( pCla );
+        Vec_PtrFree( p->vLemWarm );
+    }
     ABC_FREE( p->pTime4Outs );
     if ( p->vCexes )
         Vec_PtrFreeFree( p->vCexes );
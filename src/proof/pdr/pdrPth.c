@@ -0,0 +1,944 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded PDR with a shared queue of proof obligations.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 20, 2010.]
+
+  Revision    [$Id: pdrPth.c,v 1.00 2010/11/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int Pdr_ManSolvePth( Pdr_Man_t * p ) { return Pdr_ManSolveInt( p ); }
+
+#else // pthreads are used
+
+#define PDR_PTH_CHUNK   1024  // lemmas in one chunk of the store
+#define PDR_PTH_CHUNKS  4096  // the max number of chunks in one frame
+
+// lemmas of one frame; chunks are never moved, so that the
+// entries below the published count can be read without locking
+typedef struct Pdr_PthFrame_t_ Pdr_PthFrame_t;
+struct Pdr_PthFrame_t_
+{
+    Pdr_Set_t **     pChunks[PDR_PTH_CHUNKS]; // lemma chunks
+    atomic_int       nLemmas;                 // the number of published lemmas
+};
+
+typedef struct Pdr_PthMan_t_ Pdr_PthMan_t;
+struct Pdr_PthMan_t_
+{
+    int              nWorkers;    // the number of workers
+    Pdr_Man_t **     pWorkers;    // worker managers (the first one is the user's)
+    Vec_Ptr_t *      vFrames;     // lemma store by frame
+    Vec_Int_t **     pCursors;    // imported lemmas by frame for each worker
+    pthread_mutex_t  mutexStore;  // serializes lemma writers
+    pthread_mutex_t  mutexQueue;  // protects the obligation queue and the status
+    // block phase
+    int              kMax;        // the last frame
+    int              Prio;        // priority counter
+    int              nInFlight;   // obligations being processed
+    int              fChecking;   // the property is being checked
+    int              Status;      // -2 = running; 1 = blocked; 0 = cex; -1 = stopped
+    Abc_Cex_t *      pCex;        // counter-example
+    // push phase
+    int              kPush;       // the frame to push from
+    Vec_Int_t *      vPushRes;    // for each lemma: 1 = pushed; -1 = resource limit
+    Vec_Ptr_t *      vPushMin;    // for each pushed lemma, its reduced version (or NULL)
+};
+
+typedef struct Pdr_PthData_t_ Pdr_PthData_t;
+struct Pdr_PthData_t_
+{
+    Pdr_PthMan_t *   p;           // parallel manager
+    int              iWorker;     // worker ID
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the parallel manager.]
+
+  Description [Worker 0 is the user's manager. Other workers get their
+  own copy of the AIG because the ternary simulation and the CNF
+  computation keep their data in the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_PthMan_t * Pdr_PthManStart( Pdr_Man_t * p0, int nWorkers )
+{
+    Pdr_PthMan_t * p;
+    int w, status;
+    p = ABC_CALLOC( Pdr_PthMan_t, 1 );
+    p->nWorkers = nWorkers;
+    p->pWorkers = ABC_CALLOC( Pdr_Man_t *, nWorkers );
+    p->pCursors = ABC_CALLOC( Vec_Int_t *, nWorkers );
+    p->vFrames  = Vec_PtrAlloc( 100 );
+    p->vPushRes = Vec_IntAlloc( 100 );
+    p->vPushMin = Vec_PtrAlloc( 100 );
+    p->pWorkers[0] = p0;
+    for ( w = 0; w < nWorkers; w++ )
+    {
+        if ( w > 0 )
+        {
+            Pdr_Par_t * pPars = ABC_ALLOC( Pdr_Par_t, 1 );
+            *pPars = *p0->pPars;
+            pPars->nRandomSeed += w;
+            pPars->fVerbose     = 0;
+            pPars->fVeryVerbose = 0;
+            pPars->fDumpInv     = 0;
+            pPars->vOutMap      = NULL;
+            p->pWorkers[w] = Pdr_ManStart( Aig_ManDupSimple(p0->pAig), pPars, NULL );
+            p->pWorkers[w]->timeToStop = p0->timeToStop;
+        }
+        p->pCursors[w] = Vec_IntAlloc( 100 );
+    }
+    status = pthread_mutex_init( &p->mutexStore, NULL );  assert( status == 0 );
+    status = pthread_mutex_init( &p->mutexQueue, NULL );  assert( status == 0 );
+    p->Prio = ABC_INFINITY;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes all lemmas from the store.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthStoreClean( Pdr_PthMan_t * p )
+{
+    Pdr_PthFrame_t * pFrame;
+    int k, i, nLemmas;
+    Vec_PtrForEachEntry( Pdr_PthFrame_t *, p->vFrames, pFrame, k )
+    {
+        nLemmas = atomic_load_explicit( &pFrame->nLemmas, memory_order_relaxed );
+        for ( i = 0; i < nLemmas; i++ )
+            Pdr_SetDeref( pFrame->pChunks[i / PDR_PTH_CHUNK][i % PDR_PTH_CHUNK] );
+        atomic_store_explicit( &pFrame->nLemmas, 0, memory_order_relaxed );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the parallel manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthManStop( Pdr_PthMan_t * p )
+{
+    Pdr_PthFrame_t * pFrame;
+    Pdr_Man_t * p0 = p->pWorkers[0], * pW;
+    int w, k, i, status;
+    for ( w = 1; w < p->nWorkers; w++ )
+    {
+        Pdr_Par_t * pPars;
+        Aig_Man_t * pAig;
+        pW = p->pWorkers[w];
+        p0->nCubes  += pW->nCubes;
+        p0->nCalls  += pW->nCalls;
+        p0->nCallsS += pW->nCallsS;
+        p0->nCallsU += pW->nCallsU;
+        p0->nStarts += pW->nStarts;
+        pPars = pW->pPars;
+        pAig  = pW->pAig;
+        Pdr_ManStop( pW );
+        Aig_ManStop( pAig );
+        ABC_FREE( pPars );
+    }
+    for ( w = 0; w < p->nWorkers; w++ )
+        Vec_IntFree( p->pCursors[w] );
+    Pdr_PthStoreClean( p );
+    Vec_PtrForEachEntry( Pdr_PthFrame_t *, p->vFrames, pFrame, k )
+    {
+        for ( i = 0; i < PDR_PTH_CHUNKS && pFrame->pChunks[i]; i++ )
+            ABC_FREE( pFrame->pChunks[i] );
+        ABC_FREE( pFrame );
+    }
+    Vec_PtrFree( p->vFrames );
+    Vec_IntFree( p->vPushRes );
+    Vec_PtrFree( p->vPushMin );
+    if ( p->pCex )
+        Abc_CexFree( p->pCex );
+    status = pthread_mutex_destroy( &p->mutexStore );  assert( status == 0 );
+    status = pthread_mutex_destroy( &p->mutexQueue );  assert( status == 0 );
+    ABC_FREE( p->pCursors );
+    ABC_FREE( p->pWorkers );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Extends the lemma store to the given number of frames.]
+
+  Description [Should be called when worker threads are not running.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthStoreGrow( Pdr_PthMan_t * p, int nFrames )
+{
+    int w;
+    while ( Vec_PtrSize(p->vFrames) < nFrames )
+    {
+        Pdr_PthFrame_t * pFrame = ABC_CALLOC( Pdr_PthFrame_t, 1 );
+        atomic_store_explicit( &pFrame->nLemmas, 0, memory_order_relaxed );
+        Vec_PtrPush( p->vFrames, pFrame );
+    }
+    for ( w = 0; w < p->nWorkers; w++ )
+        while ( Vec_IntSize(p->pCursors[w]) < nFrames )
+            Vec_IntPush( p->pCursors[w], 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes a copy of the lemma in frame k.]
+
+  Description [Writers are serialized. The release store of the lemma
+  count makes the new entry visible to the readers, which do not lock.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthStorePublish( Pdr_PthMan_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_PthFrame_t * pFrame = (Pdr_PthFrame_t *)Vec_PtrEntry( p->vFrames, k );
+    int i, status;
+    status = pthread_mutex_lock( &p->mutexStore );  assert( status == 0 );
+    i = atomic_load_explicit( &pFrame->nLemmas, memory_order_relaxed );
+    assert( i < PDR_PTH_CHUNK * PDR_PTH_CHUNKS );
+    if ( pFrame->pChunks[i / PDR_PTH_CHUNK] == NULL )
+        pFrame->pChunks[i / PDR_PTH_CHUNK] = ABC_ALLOC( Pdr_Set_t *, PDR_PTH_CHUNK );
+    pFrame->pChunks[i / PDR_PTH_CHUNK][i % PDR_PTH_CHUNK] = Pdr_SetDup( pCube );
+    atomic_store_explicit( &pFrame->nLemmas, i + 1, memory_order_release );
+    status = pthread_mutex_unlock( &p->mutexStore );  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds a copy of the lemma to frame k of the worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthAddLemma( Pdr_Man_t * pW, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Set_t * pDup = Pdr_SetDup( pCube );
+    int i;
+    // set priority flops
+    for ( i = 0; i < pDup->nLits; i++ )
+    {
+        if ( (Vec_IntEntry(pW->vPrio, pDup->Lits[i] / 2) >> pW->nPrioShift) == 0 )
+            pW->nAbsFlops++;
+        Vec_IntAddToEntry( pW->vPrio, pDup->Lits[i] / 2, 1 << pW->nPrioShift );
+    }
+    Vec_VecPush( pW->vClauses, k, pDup );
+    for ( i = 1; i <= k; i++ )
+        Pdr_ManSolverAddClause( pW, i, pDup );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Imports the lemmas published since the last import.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthStoreImport( Pdr_PthMan_t * p, int iWorker )
+{
+    Pdr_Man_t * pW = p->pWorkers[iWorker];
+    Vec_Int_t * vCursor = p->pCursors[iWorker];
+    Pdr_PthFrame_t * pFrame;
+    int k, i, nLemmas;
+    Vec_PtrForEachEntryStart( Pdr_PthFrame_t *, p->vFrames, pFrame, k, 1 )
+    {
+        nLemmas = atomic_load_explicit( &pFrame->nLemmas, memory_order_acquire );
+        for ( i = Vec_IntEntry(vCursor, k); i < nLemmas; i++ )
+            Pdr_PthAddLemma( pW, k, pFrame->pChunks[i / PDR_PTH_CHUNK][i % PDR_PTH_CHUNK] );
+        Vec_IntWriteEntry( vCursor, k, nLemmas );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the lemmas of all workers identical to those of worker 0.]
+
+  Description [Used after the push phase, when threads are not running.
+  The solvers of the other workers keep the subsumed clauses, which is
+  sound because every lemma holds in its frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthStoreRebuild( Pdr_PthMan_t * p )
+{
+    Pdr_Man_t * p0 = p->pWorkers[0], * pW;
+    Pdr_PthFrame_t * pFrame;
+    Vec_Ptr_t * vArrayK, * vArrayW;
+    Pdr_Set_t * pCube;
+    int w, k, i;
+    Pdr_PthStoreClean( p );
+    Vec_VecForEachLevel( p0->vClauses, vArrayK, k )
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, i )
+            Pdr_PthStorePublish( p, k, pCube );
+    for ( w = 0; w < p->nWorkers; w++ )
+    {
+        pW = p->pWorkers[w];
+        Vec_PtrForEachEntry( Pdr_PthFrame_t *, p->vFrames, pFrame, k )
+            Vec_IntWriteEntry( p->pCursors[w], k, atomic_load_explicit(&pFrame->nLemmas, memory_order_relaxed) );
+        if ( w == 0 )
+            continue;
+        Vec_VecForEachLevel( pW->vClauses, vArrayW, k )
+        {
+            Vec_PtrForEachEntry( Pdr_Set_t *, vArrayW, pCube, i )
+                Pdr_SetDeref( pCube );
+            Vec_PtrClear( vArrayW );
+            Vec_PtrForEachEntry( Pdr_Set_t *, Vec_VecEntry(p0->vClauses, k), pCube, i )
+                Vec_PtrPush( vArrayW, Pdr_SetDup(pCube) );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the thread procedure in each worker and waits.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthRunWorkers( Pdr_PthMan_t * p, void * (*pFunc)(void *) )
+{
+    pthread_t * pThreads = ABC_ALLOC( pthread_t, p->nWorkers );
+    Pdr_PthData_t * pData = ABC_ALLOC( Pdr_PthData_t, p->nWorkers );
+    int w, status;
+    for ( w = 0; w < p->nWorkers; w++ )
+    {
+        pData[w].p       = p;
+        pData[w].iWorker = w;
+        status = pthread_create( pThreads + w, NULL, pFunc, (void *)(pData + w) );  assert( status == 0 );
+    }
+    for ( w = 0; w < p->nWorkers; w++ )
+    {
+        status = pthread_join( pThreads[w], NULL );  assert( status == 0 );
+    }
+    ABC_FREE( pThreads );
+    ABC_FREE( pData );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the status of the phase if it is still running.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Pdr_PthSetStatus( Pdr_PthMan_t * p, int Status )
+{
+    int status;
+    status = pthread_mutex_lock( &p->mutexQueue );  assert( status == 0 );
+    if ( p->Status == -2 )
+        p->Status = Status;
+    status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes one proof obligation taken from the queue.]
+
+  Description [Mirrors one iteration of Pdr_ManBlockCube(). Returns -1
+  if a resource limit is reached; 0 otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_PthBlockObl( Pdr_PthMan_t * p, int iWorker, Pdr_Obl_t * pThis )
+{
+    Pdr_Man_t * pW = p->pWorkers[iWorker];
+    Pdr_Man_t * p0 = p->pWorkers[0];
+    Pdr_Set_t * pPred = NULL, * pCubeMin = NULL;
+    int k, RetValue, status, kMax = p->kMax;
+    abctime clk;
+    Pdr_PthStoreImport( p, iWorker );
+    pW->iUseFrame = Abc_MinInt( pW->iUseFrame, pThis->iFrame );
+    clk = Abc_Clock();
+    RetValue = Pdr_ManCheckContainment( pW, pThis->iFrame, pThis->pState );
+    pW->tContain += Abc_Clock() - clk;
+    // check if the cube is already contained
+    if ( !RetValue )
+        RetValue = Pdr_ManCheckCubeCs( pW, pThis->iFrame, pThis->pState );
+    // check if the cube holds with relative induction
+    if ( !RetValue )
+    {
+        RetValue = Pdr_ManGeneralize( pW, pThis->iFrame-1, pThis->pState, &pPred, &pCubeMin );
+        if ( RetValue == 1 ) // cube is blocked inductively in this frame
+        {
+            assert( pCubeMin != NULL && pPred == NULL );
+            for ( k = pThis->iFrame; k < kMax; k++ )
+            {
+                RetValue = Pdr_ManCheckCube( pW, k, pCubeMin, NULL, 0, 0, 1 );
+                if ( RetValue != 1 )
+                    break;
+            }
+            if ( RetValue != -1 )
+            {
+                // share the lemma and bring the local frames up to date
+                Pdr_PthStorePublish( p, k, pCubeMin );
+                Pdr_PthStoreImport( p, iWorker );
+                pW->nCubes++;
+            }
+            Pdr_SetDeref( pCubeMin );
+            if ( RetValue != -1 )
+            {
+                status = pthread_mutex_lock( &p->mutexQueue );  assert( status == 0 );
+                if ( (k < kMax || pW->pPars->fReuseProofOblig) && !pW->pPars->fShortest )
+                {
+                    pThis->iFrame = k+1;
+                    pThis->prio   = p->Prio--;
+                    Pdr_QueuePush( p0, pThis );
+                }
+                else
+                    Pdr_OblDeref( pThis );
+                p->nInFlight--;
+                status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+                pThis = NULL;
+            }
+        }
+        else if ( RetValue == 0 ) // the predecessor becomes a new obligation
+        {
+            assert( pCubeMin == NULL && pPred != NULL );
+            status = pthread_mutex_lock( &p->mutexQueue );  assert( status == 0 );
+            pThis->prio = p->Prio--;
+            Pdr_QueuePush( p0, pThis );
+            Pdr_QueuePush( p0, Pdr_OblStart(pThis->iFrame-1, p->Prio--, pPred, Pdr_OblRef(pThis)) );
+            p->nInFlight--;
+            status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+            pThis = NULL;
+        }
+    }
+    if ( pThis ) // the cube was blocked or the resource limit is reached
+    {
+        status = pthread_mutex_lock( &p->mutexQueue );  assert( status == 0 );
+        Pdr_OblDeref( pThis );
+        p->nInFlight--;
+        status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+    }
+    if ( RetValue == -1 )
+        return -1;
+    // check termination
+    if ( pW->pPars->pFuncStop && pW->pPars->pFuncStop(pW->pPars->RunId) )
+        return -1;
+    if ( pW->timeToStop && Abc_Clock() > pW->timeToStop )
+        return -1;
+    if ( p0->pPars->nTimeOutGap && p0->pPars->timeLastSolved && Abc_Clock() > p0->pPars->timeLastSolved + p0->pPars->nTimeOutGap * CLOCKS_PER_SEC )
+        return -1;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread of the block phase.]
+
+  Description [Workers take obligations from the shared queue in the order
+  of Pdr_QueuePush(). When the queue has no obligations for the current
+  frames and none are being processed, one worker checks the property and
+  either schedules a new obligation or finishes the phase.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_PthBlockThread( void * pArg )
+{
+    Pdr_PthData_t * pData = (Pdr_PthData_t *)pArg;
+    Pdr_PthMan_t * p = pData->p;
+    Pdr_Man_t * pW = p->pWorkers[pData->iWorker];
+    Pdr_Man_t * p0 = p->pWorkers[0];
+    Pdr_Obl_t * pThis;
+    Pdr_Set_t * pCube = NULL;
+    int RetValue, status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( &p->mutexQueue );  assert( status == 0 );
+        if ( p->Status != -2 )
+        {
+            status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+            break;
+        }
+        pThis = Pdr_QueueIsEmpty(p0) ? NULL : Pdr_QueueHead(p0);
+        if ( pThis && pThis->iFrame == 0 ) // SAT
+        {
+            Pdr_Obl_t * pQueue = pW->pQueue;
+            pW->pQueue = pThis;
+            p->pCex    = Pdr_ManDeriveCex( pW );
+            pW->pQueue = pQueue;
+            p->Status  = 0;
+            status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+            break;
+        }
+        if ( pThis && pThis->iFrame <= p->kMax )
+        {
+            pThis = Pdr_QueuePop( p0 );
+            assert( !Pdr_SetIsInit(pThis->pState, -1) );
+            p->nInFlight++;
+            status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+            if ( Pdr_PthBlockObl( p, pData->iWorker, pThis ) == -1 )
+            {
+                Pdr_PthSetStatus( p, -1 );
+                break;
+            }
+            continue;
+        }
+        if ( p->nInFlight > 0 || p->fChecking )
+        {
+            status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+            sched_yield();
+            continue;
+        }
+        // check the property using all lemmas derived so far
+        p->fChecking = 1;
+        status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+        Pdr_PthStoreImport( p, pData->iWorker );
+        RetValue = Pdr_ManCheckCube( pW, p->kMax, NULL, &pCube, pW->pPars->nConfLimit, 0, 1 );
+        status = pthread_mutex_lock( &p->mutexQueue );  assert( status == 0 );
+        p->fChecking = 0;
+        if ( RetValue == 0 )
+        {
+            p0->nBlocks++;
+            Pdr_QueuePush( p0, Pdr_OblStart(p->kMax, p->Prio--, pCube, NULL) ); // consume ref
+        }
+        else if ( p->Status == -2 )
+            p->Status = RetValue;
+        status = pthread_mutex_unlock( &p->mutexQueue );  assert( status == 0 );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread of the push phase.]
+
+  Description [Checks the lemmas of frame kPush assigned to this worker.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_PthPushThread( void * pArg )
+{
+    Pdr_PthData_t * pData = (Pdr_PthData_t *)pArg;
+    Pdr_PthMan_t * p = pData->p;
+    Pdr_Man_t * pW = p->pWorkers[pData->iWorker];
+    Vec_Ptr_t * vArrayK = Vec_VecEntry( p->pWorkers[0]->vClauses, p->kPush );
+    Pdr_Set_t * pCubeK;
+    int j, RetValue;
+    Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCubeK, j )
+    {
+        if ( j % p->nWorkers != pData->iWorker )
+            continue;
+        RetValue = Pdr_ManCheckCube( pW, p->kPush, pCubeK, NULL, 0, 0, 1 );
+        Vec_IntWriteEntry( p->vPushRes, j, RetValue );
+        if ( RetValue == -1 )
+            break;
+        if ( RetValue == 1 )
+            Vec_PtrWriteEntry( p->vPushMin, j, Pdr_ManReduceClause(pW, p->kPush, pCubeK) );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the cubes contained in other cubes of this frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthRemoveContained( Vec_Ptr_t * vArrayK )
+{
+    Pdr_Set_t * pCubeK, * pTemp;
+    int j, m;
+    Vec_PtrSort( vArrayK, (int (*)(const void *, const void *))Pdr_SetCompare );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCubeK, j )
+        Vec_PtrForEachEntryStart( Pdr_Set_t *, vArrayK, pTemp, m, j+1 )
+        {
+            if ( !Pdr_SetContains( pTemp, pCubeK ) ) // pCubeK contains pTemp
+                continue;
+            Pdr_SetDeref( pTemp );
+            Vec_PtrWriteEntry( vArrayK, m, Vec_PtrEntryLast(vArrayK) );
+            Vec_PtrPop(vArrayK);
+            m--;
+        }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel version of Pdr_ManPushClauses().]
+
+  Description [Frames are swept in order. The lemmas of one frame are
+  checked by all workers in parallel, after which worker 0 moves the
+  inductive ones into the next frame and adds them to the solvers of all
+  workers. Returns 1 if some frame has no lemmas left, -1 on timeout.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_PthPushClauses( Pdr_PthMan_t * p )
+{
+    Pdr_Man_t * p0 = p->pWorkers[0];
+    Pdr_Set_t * pCubeK, * pCubeK1, * pCubeMin;
+    Vec_Ptr_t * vArrayK, * vArrayK1;
+    int i, j, k, w, RetValue = 0, kMax = Vec_PtrSize(p0->vSolvers)-1;
+    int iStartFrame = p0->pPars->fShiftStart ? p0->iUseFrame : 1;
+    abctime clk = Abc_Clock();
+    assert( p0->iUseFrame > 0 );
+    for ( k = iStartFrame; k < kMax; k++ )
+    {
+        vArrayK  = Vec_VecEntry( p0->vClauses, k );
+        vArrayK1 = Vec_VecEntry( p0->vClauses, k+1 );
+        Pdr_PthRemoveContained( vArrayK );
+        // check if the lemmas can be moved to the next frame
+        p->kPush = k;
+        Vec_IntFill( p->vPushRes, Vec_PtrSize(vArrayK), 0 );
+        Vec_PtrFill( p->vPushMin, Vec_PtrSize(vArrayK), NULL );
+        if ( Vec_PtrSize(vArrayK) >= 2 * p->nWorkers )
+            Pdr_PthRunWorkers( p, Pdr_PthPushThread );
+        else
+            Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCubeK, j )
+            {
+                Vec_IntWriteEntry( p->vPushRes, j, Pdr_ManCheckCube(p0, k, pCubeK, NULL, 0, 0, 1) );
+                if ( Vec_IntEntry(p->vPushRes, j) == -1 )
+                    break;
+                if ( Vec_IntEntry(p->vPushRes, j) == 1 )
+                    Vec_PtrWriteEntry( p->vPushMin, j, Pdr_ManReduceClause(p0, k, pCubeK) );
+            }
+        if ( Vec_IntFind(p->vPushRes, -1) >= 0 )
+        {
+            Vec_PtrForEachEntry( Pdr_Set_t *, p->vPushMin, pCubeMin, j )
+                if ( pCubeMin )
+                    Pdr_SetDeref( pCubeMin );
+            return -1;
+        }
+        // move the inductive lemmas
+        for ( j = Vec_PtrSize(vArrayK) - 1; j >= 0; j-- )
+        {
+            if ( Vec_IntEntry(p->vPushRes, j) != 1 )
+                continue;
+            pCubeK = (Pdr_Set_t *)Vec_PtrEntry( vArrayK, j );
+            pCubeMin = (Pdr_Set_t *)Vec_PtrEntry( p->vPushMin, j );
+            if ( pCubeMin != NULL )
+            {
+                Pdr_SetDeref( pCubeK );
+                pCubeK = pCubeMin;
+            }
+            for ( w = 0; w < p->nWorkers; w++ )
+                Pdr_ManSolverAddClause( p->pWorkers[w], k+1, pCubeK );
+            // check if the clause subsumes others
+            Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK1, pCubeK1, i )
+            {
+                if ( !Pdr_SetContains( pCubeK1, pCubeK ) ) // pCubeK contains pCubeK1
+                    continue;
+                Pdr_SetDeref( pCubeK1 );
+                Vec_PtrWriteEntry( vArrayK1, i, Vec_PtrEntryLast(vArrayK1) );
+                Vec_PtrPop(vArrayK1);
+                i--;
+            }
+            Vec_PtrPush( vArrayK1, pCubeK );
+            Vec_PtrWriteEntry( vArrayK, j, Vec_PtrEntryLast(vArrayK) );
+            Vec_PtrPop(vArrayK);
+        }
+        if ( Vec_PtrSize(vArrayK) == 0 )
+            RetValue = 1;
+    }
+    // clean up the last one
+    Pdr_PthRemoveContained( Vec_VecEntry(p0->vClauses, kMax) );
+    Pdr_PthStoreRebuild( p );
+    p0->tPush += Abc_Clock() - clk;
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the reason for stopping.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthReportStop( Pdr_Man_t * p, int iFrame, abctime clkStart )
+{
+    if ( p->pPars->fVerbose )
+        Pdr_ManPrintProgress( p, 1, Abc_Clock() - clkStart );
+    if ( p->pPars->fSilent )
+        return;
+    if ( p->timeToStop && Abc_Clock() > p->timeToStop )
+        Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOut, iFrame );
+    else if ( p->pPars->nTimeOutGap && p->pPars->timeLastSolved && Abc_Clock() > p->pPars->timeLastSolved + p->pPars->nTimeOutGap * CLOCKS_PER_SEC )
+        Abc_Print( 1, "Reached gap timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOutGap, iFrame );
+    else if ( p->pPars->nConfLimit )
+        Abc_Print( 1, "Reached conflict limit (%d) in frame %d.\n",  p->pPars->nConfLimit, iFrame );
+    else if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Computation cancelled by the callback in frame %d.\n", iFrame );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded version of Pdr_ManSolveInt().]
+
+  Description [Each worker has its own AIG copy and its own solvers for
+  all frames. The workers take proof obligations from one queue sorted
+  by frame and priority and share lemmas through the per-frame store.
+  Modes that depend on the order of the sequential run (solving all
+  outputs, abstraction, per-output timeouts) are not supported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePth( Pdr_Man_t * p0 )
+{
+    Pdr_PthMan_t * p;
+    Pdr_Man_t * pW;
+    Aig_Obj_t * pObj;
+    int iFrame, iOut, w, RetValue = -1;
+    abctime clkStart = Abc_Clock();
+    assert( !p0->pPars->fSolveAll && !p0->pPars->fUseAbs && !p0->pPars->nTimeOutOne );
+    p0->timeToStop = p0->pPars->nTimeOut ? p0->pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    assert( Vec_PtrSize(p0->vSolvers) == 0 );
+    p = Pdr_PthManStart( p0, p0->pPars->nThreads );
+    // create the first timeframe
+    p0->pPars->timeLastSolved = Abc_Clock();
+    for ( w = 0; w < p->nWorkers; w++ )
+        Pdr_ManCreateSolver( p->pWorkers[w], 0 );
+    Pdr_PthStoreGrow( p, 1 );
+    iFrame = 0;
+    while ( 1 )
+    {
+        p->kMax = iFrame;
+        for ( w = 0; w < p->nWorkers; w++ )
+        {
+            pW = p->pWorkers[w];
+            pW->nFrames = iFrame;
+            pW->iUseFrame = Abc_MaxInt(iFrame, 1);
+        }
+        Saig_ManForEachPo( p0->pAig, pObj, iOut )
+        {
+            // check if the output is trivially solved
+            if ( Aig_ObjChild0(pObj) == Aig_ManConst0(p0->pAig) )
+                continue;
+            if ( Aig_ObjChild0(pObj) == Aig_ManConst1(p0->pAig) )
+            {
+                p0->pAig->pSeqModel = Abc_CexMakeTriv( Aig_ManRegNum(p0->pAig), Saig_ManPiNum(p0->pAig), Saig_ManPoNum(p0->pAig), iFrame*Saig_ManPoNum(p0->pAig)+iOut );
+                p0->pPars->iFrame = iFrame;
+                RetValue = 0; // SAT
+                goto finish;
+            }
+            // block all states of this output in the last frame
+            for ( w = 0; w < p->nWorkers; w++ )
+                p->pWorkers[w]->iOutCur = iOut;
+            p->Status    = -2;
+            p->nInFlight = 0;
+            p->fChecking = 0;
+            Pdr_PthRunWorkers( p, Pdr_PthBlockThread );
+            for ( w = 0; w < p->nWorkers; w++ )
+                Pdr_PthStoreImport( p, w );
+            if ( p->Status == 0 )
+            {
+                if ( p0->pPars->fVerbose )
+                    Pdr_ManPrintProgress( p0, 1, Abc_Clock() - clkStart );
+                p0->pPars->iFrame = iFrame;
+                p0->pAig->pSeqModel = p->pCex;
+                p->pCex = NULL;
+                RetValue = 0; // SAT
+                goto finish;
+            }
+            if ( p->Status == -1 )
+            {
+                Pdr_PthReportStop( p0, iFrame, clkStart );
+                p0->pPars->iFrame = iFrame;
+                RetValue = -1;
+                goto finish;
+            }
+            assert( p->Status == 1 );
+            if ( p0->pPars->fVerbose )
+                Pdr_ManPrintProgress( p0, 0, Abc_Clock() - clkStart );
+        }
+        if ( p0->pPars->fVerbose )
+            Pdr_ManPrintProgress( p0, 1, Abc_Clock() - clkStart );
+        // open a new timeframe
+        for ( w = 0; w < p->nWorkers; w++ )
+        {
+            pW = p->pWorkers[w];
+            Pdr_ManSetPropertyOutput( pW, iFrame );
+            Pdr_ManCreateSolver( pW, iFrame+1 );
+            p0->iUseFrame = Abc_MinInt( p0->iUseFrame, pW->iUseFrame );
+        }
+        Pdr_PthStoreGrow( p, ++iFrame + 1 );
+        if ( iFrame == 1 && p0->vLemWarm )
+        {
+            Pdr_Set_t * pCube;
+            Vec_PtrForEachEntry( Pdr_Set_t *, p0->vLemWarm, pCube, w )
+            {
+                Pdr_PthStorePublish( p, 1, pCube );
+                Pdr_SetDeref( pCube );
+            }
+            Vec_PtrFreeP( &p0->vLemWarm );
+            for ( w = 0; w < p->nWorkers; w++ )
+                Pdr_PthStoreImport( p, w );
+        }
+        // push clauses into this timeframe
+        RetValue = Pdr_PthPushClauses( p );
+        if ( RetValue == -1 )
+        {
+            if ( p0->pPars->fVerbose )
+                Pdr_ManPrintProgress( p0, 1, Abc_Clock() - clkStart );
+            if ( !p0->pPars->fSilent )
+            {
+                if ( p0->timeToStop && Abc_Clock() > p0->timeToStop )
+                    Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  p0->pPars->nTimeOut, iFrame );
+                else
+                    Abc_Print( 1, "Reached conflict limit (%d) in frame %d.\n",  p0->pPars->nConfLimit, iFrame );
+            }
+            p0->pPars->iFrame = iFrame;
+            goto finish;
+        }
+        if ( RetValue )
+        {
+            if ( p0->pPars->fVerbose )
+                Pdr_ManPrintProgress( p0, 1, Abc_Clock() - clkStart );
+            if ( !p0->pPars->fSilent )
+                Pdr_ManReportInvariant( p0 );
+            if ( !p0->pPars->fSilent )
+                Pdr_ManVerifyInvariant( p0 );
+            p0->pPars->iFrame = iFrame;
+            p0->pPars->nProveOuts = Saig_ManPoNum(p0->pAig);
+            RetValue = 1; // UNSAT
+            goto finish;
+        }
+        if ( p0->pPars->fVerbose )
+            Pdr_ManPrintProgress( p0, 0, Abc_Clock() - clkStart );
+        // check termination
+        RetValue = -1;
+        if ( p0->pPars->pFuncStop && p0->pPars->pFuncStop(p0->pPars->RunId) )
+        {
+            p0->pPars->iFrame = iFrame;
+            goto finish;
+        }
+        if ( (p0->timeToStop && Abc_Clock() > p0->timeToStop) ||
+             (p0->pPars->nTimeOutGap && p0->pPars->timeLastSolved && Abc_Clock() > p0->pPars->timeLastSolved + p0->pPars->nTimeOutGap * CLOCKS_PER_SEC) )
+        {
+            Pdr_PthReportStop( p0, iFrame, clkStart );
+            p0->pPars->iFrame = iFrame;
+            goto finish;
+        }
+        if ( p0->pPars->nFrameMax && iFrame >= p0->pPars->nFrameMax )
+        {
+            if ( p0->pPars->fVerbose )
+                Pdr_ManPrintProgress( p0, 1, Abc_Clock() - clkStart );
+            if ( !p0->pPars->fSilent )
+                Abc_Print( 1, "Reached limit on the number of timeframes (%d).\n", p0->pPars->nFrameMax );
+            p0->pPars->iFrame = iFrame;
+            goto finish;
+        }
+    }
+finish:
+    Pdr_PthManStop( p );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
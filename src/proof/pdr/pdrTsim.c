@@ -187,76 +187,111 @@ int Pdr_ManSimDataInit( Aig_Man_t * pAig,
 
 /**Function*************************************************************
 
-  Synopsis    [Tries to assign ternary value to one of the CIs.]
-
-  Description []
-
+  Synopsis    [Performs 64-way bit-parallel ternary simulation.]
+
+  Description [Each object has two words: the i-th bit of the first word 
+  is set if the object can be 0 in the i-th pattern; the i-th bit of the 
+  second word is set if it can be 1. All patterns make the CIs in vCi2Rem 
+  undefined. If fPrefix is 0, the i-th pattern also makes the i-th CI in 
+  vBatch undefined. If fPrefix is 1, it makes undefined the CIs 0..i of 
+  vBatch. Returns the mask of patterns, in which all COs remain binary.]
+               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Pdr_ManExtendOne( Aig_Man_t * pAig, Aig_Obj_t * pObj, Vec_Int_t * vUndo, Vec_Int_t * vVis )
+word Pdr_ManSimWords( Pdr_Man_t * p, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vNodes,
+    Vec_Int_t * vCoObjs, Vec_Int_t * vCi2Rem, Vec_Int_t * vBatch, int fPrefix )
 {
-    Aig_Obj_t * pFanout;
-    int i, k, iFanout = -1, Value, Value2;
-    assert( Saig_ObjIsLo(pAig, pObj) );
-    assert( Aig_ObjIsTravIdCurrent(pAig, pObj) );
-    // save original value
-    Value = Pdr_ManSimInfoGet( pAig, pObj );
-    assert( Value == PDR_ZER || Value == PDR_ONE );
-    Vec_IntPush( vUndo, Aig_ObjId(pObj) );
-    Vec_IntPush( vUndo, Value );
-    // update original value
-    Pdr_ManSimInfoSet( pAig, pObj, PDR_UND );
-    // traverse
-    Vec_IntClear( vVis );
-    Vec_IntPush( vVis, Aig_ObjId(pObj) );
-    Aig_ManForEachObjVec( vVis, pAig, pObj, i )
+    word * pSim = Vec_WrdArray( p->vTerSim ), * pSim0, * pSim1, Mask, Fail = 0;
+    Aig_Obj_t * pObj;
+    int i, Id;
+    assert( Vec_IntSize(vBatch) <= 64 );
+    // set the CI values
+    Id = Aig_ObjId( Aig_ManConst1(p->pAig) );
+    pSim[2*Id+0] = 0;
+    pSim[2*Id+1] = ~(word)0;
+    Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
     {
-        Aig_ObjForEachFanout( pAig, pObj, pFanout, iFanout, k )
-        {
-            if ( !Aig_ObjIsTravIdCurrent(pAig, pFanout) )
-                continue;
-            assert( Aig_ObjId(pObj) < Aig_ObjId(pFanout) );
-            Value = Pdr_ManSimInfoGet( pAig, pFanout );
-            if ( Value == PDR_UND )
-                continue;
-            Value2 = Pdr_ManExtendOneEval( pAig, pFanout );
-            if ( Value2 == Value )
-                continue;
-            assert( Value2 == PDR_UND );
-            Vec_IntPush( vUndo, Aig_ObjId(pFanout) );
-            Vec_IntPush( vUndo, Value );
-            if ( Aig_ObjIsCo(pFanout) )
-                return 0;
-            assert( Aig_ObjIsNode(pFanout) );
-            Vec_IntPushOrder( vVis, Aig_ObjId(pFanout) );
-        }
+        Id = Aig_ObjId(pObj);
+        pSim[2*Id+0] = Vec_IntEntry(vCiVals, i) ? 0 : ~(word)0;
+        pSim[2*Id+1] = Vec_IntEntry(vCiVals, i) ? ~(word)0 : 0;
     }
-    return 1;
+    Vec_IntForEachEntry( vCi2Rem, Id, i )
+        pSim[2*Id+0] = pSim[2*Id+1] = ~(word)0;
+    Vec_IntForEachEntry( vBatch, Id, i )
+    {
+        Mask = fPrefix ? ~(word)0 << i : (word)1 << i;
+        pSim[2*Id+0] |= Mask;
+        pSim[2*Id+1] |= Mask;
+    }
+    // simulate the nodes
+    Aig_ManForEachObjVec( vNodes, p->pAig, pObj, i )
+    {
+        Id    = Aig_ObjId(pObj);
+        pSim0 = pSim + 2*Aig_ObjFaninId0(pObj);
+        pSim1 = pSim + 2*Aig_ObjFaninId1(pObj);
+        pSim[2*Id+0] = pSim0[Aig_ObjFaninC0(pObj)]  | pSim1[Aig_ObjFaninC1(pObj)];
+        pSim[2*Id+1] = pSim0[!Aig_ObjFaninC0(pObj)] & pSim1[!Aig_ObjFaninC1(pObj)];
+    }
+    // a pattern fails if any of the COs is undefined
+    Aig_ManForEachObjVec( vCoObjs, p->pAig, pObj, i )
+    {
+        pSim0 = pSim + 2*Aig_ObjFaninId0(pObj);
+        Fail |= pSim0[0] & pSim0[1];
+    }
+    return ~Fail;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Undoes the partial results of ternary simulation.]
+  Synopsis    [Tries to assign ternary values to the candidate CIs.]
 
-  Description []
+  Description [Visits the candidates in the given order and makes each of 
+  them undefined unless this makes one of the COs undefined. The result is 
+  the same as when the candidates are tried one at a time, but up to 64 of 
+  them are tried in one pass over the cone. Since ternary simulation is 
+  monotone, a candidate failing on its own is dropped without further checks.
+  The remaining ones are tried as nested prefixes: the longest successful 
+  prefix is accepted, the next candidate is rejected, and the rest is tried 
+  again. Appends the accepted candidates to vCi2Rem.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Pdr_ManExtendUndo( Aig_Man_t * pAig, Vec_Int_t * vUndo )
+void Pdr_ManExtendWords( Pdr_Man_t * p, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vNodes,
+    Vec_Int_t * vCoObjs, Vec_Int_t * vCands, Vec_Int_t * vCi2Rem )
 {
-    Aig_Obj_t * pObj;
-    int i, Value;
-    Aig_ManForEachObjVec( vUndo, pAig, pObj, i )
+    Vec_Int_t * vBatch = p->vVisits;
+    word Res;
+    int i, k, iStart, nPref;
+    for ( iStart = 0; iStart < Vec_IntSize(vCands); iStart += 64 )
     {
-        Value  = Vec_IntEntry(vUndo, ++i);
-        assert( Pdr_ManSimInfoGet(pAig, pObj) == PDR_UND );
-        Pdr_ManSimInfoSet( pAig, pObj, Value );
+        // try each candidate on its own
+        Vec_IntClear( vBatch );
+        for ( i = iStart; i < Abc_MinInt(iStart + 64, Vec_IntSize(vCands)); i++ )
+            Vec_IntPush( vBatch, Vec_IntEntry(vCands, i) );
+        Res = Pdr_ManSimWords( p, vCiObjs, vCiVals, vNodes, vCoObjs, vCi2Rem, vBatch, 0 );
+        for ( i = k = 0; i < Vec_IntSize(vBatch); i++ )
+            if ( (Res >> i) & 1 )
+                Vec_IntWriteEntry( vBatch, k++, Vec_IntEntry(vBatch, i) );
+        Vec_IntShrink( vBatch, k );
+        // try the prefixes of the remaining candidates
+        while ( Vec_IntSize(vBatch) > 0 )
+        {
+            Res = Pdr_ManSimWords( p, vCiObjs, vCiVals, vNodes, vCoObjs, vCi2Rem, vBatch, 1 );
+            for ( nPref = 0; nPref < Vec_IntSize(vBatch) && ((Res >> nPref) & 1); nPref++ )
+                Vec_IntPush( vCi2Rem, Vec_IntEntry(vBatch, nPref) );
+            if ( nPref == Vec_IntSize(vBatch) )
+                break;
+            // skip the failed candidate and continue
+            for ( i = nPref + 1, k = 0; i < Vec_IntSize(vBatch); i++ )
+                Vec_IntWriteEntry( vBatch, k++, Vec_IntEntry(vBatch, i) );
+            Vec_IntShrink( vBatch, k );
+        }
     }
 }
 
@@ -358,12 +393,11 @@ Pdr_Set_t * Pdr_ManTernarySim( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
     Vec_Int_t * vCiVals = p->vCiVals;  // cone leaf values (0/1 CI values)
     Vec_Int_t * vCoVals = p->vCoVals;  // cone root values (0/1 CO values)
     Vec_Int_t * vNodes  = p->vNodes;   // cone nodes (node obj IDs)
-    Vec_Int_t * vUndo   = p->vUndo;    // cone undos (node obj IDs)
-    Vec_Int_t * vVisits = p->vVisits;  // intermediate (obj IDs)
+    Vec_Int_t * vCands  = p->vCands;   // flops to be tried (CI obj IDs)
     Vec_Int_t * vCi2Rem = p->vCi2Rem;  // CIs to be removed (CI obj IDs)
     Vec_Int_t * vRes    = p->vRes;     // final result (flop literals)
     Aig_Obj_t * pObj;
-    int i, Entry, RetValue;
+    int i, fHigh, Entry, RetValue;
     //abctime clk = Abc_Clock();
 
     // collect CO objects
@@ -398,13 +432,11 @@ Abc_Print( 1, " in frame %d.\n", k );
     // collect values
     Pdr_ManCollectValues( p, k, vCiObjs, vCiVals );
     Pdr_ManCollectValues( p, k, vCoObjs, vCoVals );
-    // simulate for the first time
 if ( p->pPars->fVeryVerbose )
 Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
-    RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, NULL );
-    assert( RetValue );
 
-    // iteratively remove flops
+    // order the flops to be removed
+    Vec_IntClear( vCands );
     if ( p->pPars->fFlopPrio )
     {
         // collect flops and sort them by priority
@@ -419,50 +451,28 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
         Vec_IntSelectSortCost( Vec_IntArray(vRes), Vec_IntSize(vRes), vPrio );
 
         // try removing flops starting from low-priority to high-priority
-        Vec_IntClear( vCi2Rem );
         Vec_IntForEachEntry( vRes, Entry, i )
-        {
-            pObj = Aig_ManCi( p->pAig, Saig_ManPiNum(p->pAig) + Entry );
-            assert( Saig_ObjIsLo( p->pAig, pObj ) );
-            Vec_IntClear( vUndo );
-            if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-            else
-                Pdr_ManExtendUndo( p->pAig, vUndo );
-        }
+            Vec_IntPush( vCands, Aig_ObjId(Aig_ManCi(p->pAig, Saig_ManPiNum(p->pAig) + Entry)) );
     }
     else
     {
-        // try removing low-priority flops first
-        Vec_IntClear( vCi2Rem );
-        Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+        // try removing low-priority flops first and high-priority flops next
+        for ( fHigh = 0; fHigh < 2; fHigh++ )
         {
-            if ( !Saig_ObjIsLo( p->pAig, pObj ) )
-                continue;
-            Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
-            if ( Vec_IntEntry(vPrio, Entry) )
-                continue;
-            Vec_IntClear( vUndo );
-            if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-            else
-                Pdr_ManExtendUndo( p->pAig, vUndo );
-        }
-        // try removing high-priority flops next
-        Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
-        {
-            if ( !Saig_ObjIsLo( p->pAig, pObj ) )
-                continue;
-            Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
-            if ( !Vec_IntEntry(vPrio, Entry) )
-                continue;
-            Vec_IntClear( vUndo );
-            if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-            else
-                Pdr_ManExtendUndo( p->pAig, vUndo );
+            Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+            {
+                if ( !Saig_ObjIsLo( p->pAig, pObj ) )
+                    continue;
+                Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
+                if ( (Vec_IntEntry(vPrio, Entry) != 0) != fHigh )
+                    continue;
+                Vec_IntPush( vCands, Aig_ObjId(pObj) );
+            }
         }
     }
+    // iteratively remove flops
+    Vec_IntClear( vCi2Rem );
+    Pdr_ManExtendWords( p, vCiObjs, vCiVals, vNodes, vCoObjs, vCands, vCi2Rem );
 
 if ( p->pPars->fVeryVerbose )
 Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, vCi2Rem );
@@ -613,6 +613,7 @@ Pdr_Obl_t * Pdr_QueuePop( Pdr_Man_t * p )
     if ( p->pQueue == NULL )
         return NULL;
     p->pQueue = p->pQueue->pLink;
+    pRes->pLink = NULL;
     Pdr_OblDeref( pRes );
     p->nQueCur--;
     return pRes;
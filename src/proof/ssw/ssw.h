@@ -43,6 +43,8 @@ struct Ssw_Pars_t_
     int              nPartSize;     // size of the partition
     int              nOverSize;     // size of the overlap between partitions
     int              nProcs;        // the number of processors
+    int              nPartMemLimit; // the memory limit per partition in MB (0 = no limit)
+    int              fPartIterate;  // repeats partitioned computation till fix-point
     int              nFramesK;      // the induction depth
     int              nFramesAddSim; // the number of additional frames to simulate
     int              fConstrs;      // treat the last nConstrs POs as seq constraints
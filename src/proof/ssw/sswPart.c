@@ -77,6 +77,30 @@ void Ssw_SignalCorrespondenceArray1( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
             Cec_ManLSCorrespondenceClasses( pGia, pCorPars );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performing SAT sweeping for the array of AIG partitions.]
+
+  Description [Partitions whose entry in vIters is negative are skipped.
+  On return, vIters contains the number of iterations for each partition.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SignalCorrespondenceAigs1( Vec_Ptr_t * vAigs, Vec_Int_t * vIters, Ssw_Pars_t * pPars )
+{
+    Aig_Man_t * pAig; int i;
+    Vec_PtrForEachEntry( Aig_Man_t *, vAigs, pAig, i )
+    {
+        if ( Vec_IntEntry(vIters, i) < 0 )
+            continue;
+        Aig_ManStop( Ssw_SignalCorrespondence( pAig, pPars ) );
+        Vec_IntWriteEntry( vIters, i, pPars->nIters );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performing SAT sweeping for the array of AIGs.]
@@ -95,6 +119,11 @@ void Ssw_SignalCorrespondenceArray( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
     Ssw_SignalCorrespondenceArray1( vGias, pPars );
 }
 
+void Ssw_SignalCorrespondenceAigs( Vec_Ptr_t * vAigs, Vec_Int_t * vIters, Ssw_Pars_t * pPars )
+{
+    Ssw_SignalCorrespondenceAigs1( vAigs, vIters, pPars );
+}
+
 #else // pthreads are used
 
 
@@ -197,9 +226,334 @@ void Ssw_SignalCorrespondenceArray( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
         pthread_join( WorkerThread[i], NULL );
 }
 
+typedef struct Par_SswThData_t_
+{
+    Ssw_Pars_t   Pars;
+    Aig_Man_t *  p;
+    int *        pIters;
+    int          iThread;
+    atomic_bool  fWorking;
+} Par_SswThData_t;
+
+void * Ssw_AigWorkerThread( void * pArg )
+{
+    struct timespec pause_duration;
+    pause_duration.tv_sec = 0;
+    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
+
+    Par_SswThData_t * pThData = (Par_SswThData_t *)pArg;
+    while ( 1 )
+    {
+        while ( !atomic_load_explicit((atomic_bool *)&pThData->fWorking, memory_order_acquire) )
+            nanosleep(&pause_duration, NULL);
+        if ( pThData->p == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Aig_ManStop( Ssw_SignalCorrespondence( pThData->p, &pThData->Pars ) );
+        *pThData->pIters = pThData->Pars.nIters;
+        atomic_store_explicit(&pThData->fWorking, false, memory_order_release);
+    }
+    assert( 0 );
+    return NULL;
+}
+
+void Ssw_SignalCorrespondenceAigs( Vec_Ptr_t * vAigs, Vec_Int_t * vIters, Ssw_Pars_t * pPars )
+{
+    Par_SswThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    int i, status, iPart = 0, nProcs = pPars->nProcs;
+    if ( pPars->nProcs < 2 )
+        return Ssw_SignalCorrespondenceAigs1( vAigs, vIters, pPars );
+    // subtract manager thread
+    nProcs--;
+    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
+    // start threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].Pars    = *pPars;
+        ThData[i].p       = NULL;
+        ThData[i].pIters  = NULL;
+        ThData[i].iThread = i;
+        atomic_store_explicit(&ThData[i].fWorking, false, memory_order_release);
+        status = pthread_create( WorkerThread + i, NULL, Ssw_AigWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+
+    struct timespec pause_duration;
+    pause_duration.tv_sec = 0;
+    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
+
+    // look at the threads
+    while ( iPart < Vec_PtrSize(vAigs) )
+    {
+        if ( Vec_IntEntry(vIters, iPart) < 0 )
+        {
+            iPart++;
+            continue;
+        }
+        for ( i = 0; i < nProcs; i++ )
+        {
+            if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
+                continue;
+            ThData[i].p      = (Aig_Man_t *)Vec_PtrEntry( vAigs, iPart );
+            ThData[i].pIters = Vec_IntEntryP( vIters, iPart++ );
+            atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
+            break;
+        }
+        if ( i == nProcs )
+            nanosleep(&pause_duration, NULL);
+    }
+    // wait till threads finish
+    for ( i = 0; i < nProcs; i++ )
+    {
+        if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
+            i = -1; // Start from the beginning again
+        nanosleep(&pause_duration, NULL);
+    }
+
+    // stop threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p = NULL;
+        atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
+    }
+
+    // Join threads
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+}
+
 #endif // pthreads are used
 
 
+/**Function*************************************************************
+
+  Synopsis    [Estimates memory (in MB) needed to solve one partition.]
+
+  Description [Accounts for the time frames unrolled for induction and
+  simulation together with the SAT solver data built for them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Ssw_ManPartMemEstimate( Aig_Man_t * pPart, Ssw_Pars_t * pPars )
+{
+    double Mem = 200.0 * Aig_ManObjNumMax(pPart) * (pPars->nFramesK + pPars->nFramesAddSim + 1);
+    return (int)(Mem / (1 << 20));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives partition AIGs fitting into the memory limit.]
+
+  Description [Partitions estimated to exceed pPars->nPartMemLimit are
+  split in half (and the halves are appended to vResult) until they fit
+  or consist of one register. Returns the array of partition AIGs, in
+  the order of vResult. Fills in the arrays of back-maps and the pairs
+  (true PIs, external registers) for each partition.]
+               
+  SideEffects [Updates vResult.]
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Ssw_ManPartCollect( Aig_Man_t * pAig, Vec_Ptr_t * vResult, Ssw_Pars_t * pPars, Vec_Ptr_t * vMaps, Vec_Int_t * vCounts, int fVerbose )
+{
+    Vec_Ptr_t * vAigs = Vec_PtrAlloc( Vec_PtrSize(vResult) );
+    Aig_Man_t * pTemp;
+    Vec_Int_t * vPart;
+    int * pMapBack;
+    int i, nCountPis, nCountRegs, nSplits = 0;
+    for ( i = 0; i < Vec_PtrSize(vResult); i++ )
+    {
+        vPart = (Vec_Int_t *)Vec_PtrEntry( vResult, i );
+        pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack );
+        if ( pPars->nPartMemLimit && Vec_IntSize(vPart) > 1 && Ssw_ManPartMemEstimate(pTemp, pPars) > pPars->nPartMemLimit )
+        {
+            Aig_ManStop( pTemp );
+            ABC_FREE( pMapBack );
+            Aig_ManPartDivide( vResult, vPart, (Vec_IntSize(vPart) + 1) / 2, 0 );
+            Vec_PtrDrop( vResult, i-- );
+            Vec_IntFree( vPart );
+            nSplits++;
+            continue;
+        }
+        Aig_ManSetRegNum( pTemp, pTemp->nRegs );
+        // create the projection of 1-hot registers
+        if ( pAig->vOnehots )
+            pTemp->vOnehots = Aig_ManRegProjectOnehots( pAig, pTemp, pAig->vOnehots, fVerbose );
+        Vec_PtrPush( vAigs, pTemp );
+        Vec_PtrPush( vMaps, pMapBack );
+        Vec_IntPushTwo( vCounts, nCountPis, nCountRegs );
+    }
+    if ( fVerbose && nSplits )
+        Abc_Print( 1, "Memory limit %d MB caused %d partition splits. Using %d partitions.\n", pPars->nPartMemLimit, nSplits, Vec_PtrSize(vAigs) );
+    return vAigs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of partitioned sequential SAT sweeping.]
+
+  Description [Solves partitions independently (concurrently if
+  pPars->nProcs > 1), then merges the equivalences into pAig in the
+  order of partitions and returns the reduced AIG. The result does not
+  depend on the number of processes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Ssw_SignalCorrespondencePartRound( Aig_Man_t * pAig, Vec_Ptr_t * vResult, Ssw_Pars_t * pPars, int fUseGia, int fVerbose )
+{
+    Aig_Man_t * pTemp, * pTemp2, * pNew;
+    Vec_Ptr_t * vAigs, * vGias = NULL;
+    Vec_Ptr_t * vMaps = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vCounts = Vec_IntAlloc( 200 );
+    Vec_Int_t * vIters, * vPart;
+    Gia_Man_t * pGia;
+    int * pMapBack;
+    int i, nClasses;
+    vAigs  = Ssw_ManPartCollect( pAig, vResult, pPars, vMaps, vCounts, fVerbose );
+    vIters = Vec_IntStart( Vec_PtrSize(vAigs) );
+    // solve partitions
+    if ( fUseGia )
+    {
+        vGias = Vec_PtrAlloc( Vec_PtrSize(vAigs) );
+        Vec_PtrForEachEntry( Aig_Man_t *, vAigs, pTemp, i )
+            Vec_PtrPush( vGias, Gia_ManFromAigSimple(pTemp) );
+        Ssw_SignalCorrespondenceArray( vGias, pPars );
+    }
+    else
+    {
+        // skip partitions without true PIs
+        Vec_PtrForEachEntry( Aig_Man_t *, vAigs, pTemp, i )
+            if ( Vec_IntEntry(vCounts, 2*i) == 0 )
+                Vec_IntWriteEntry( vIters, i, -1 );
+        Ssw_SignalCorrespondenceAigs( vAigs, vIters, pPars );
+    }
+    // collect the results
+    Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
+    Vec_PtrForEachEntry( Aig_Man_t *, vAigs, pTemp, i )
+    {
+        vPart    = (Vec_Int_t *)Vec_PtrEntry( vResult, i );
+        pMapBack = (int *)Vec_PtrEntry( vMaps, i );
+        if ( fUseGia )
+        {
+            pGia   = (Gia_Man_t *)Vec_PtrEntry( vGias, i );
+            pTemp2 = Gia_ManToAigSimple( pGia );
+            Gia_ManReprToAigRepr2( pTemp2, pGia );
+            nClasses = Aig_TransferMappedClasses( pAig, pTemp2, pMapBack );
+            Aig_ManStop( pTemp2 );
+            Gia_ManStop( pGia );
+        }
+        else if ( Vec_IntEntry(vIters, i) >= 0 )
+            nClasses = Aig_TransferMappedClasses( pAig, pTemp, pMapBack );
+        else
+            nClasses = 0;
+        if ( fVerbose )
+            Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
+                i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), Vec_IntEntry(vCounts, 2*i), Vec_IntEntry(vCounts, 2*i+1),
+                Aig_ManNodeNum(pTemp), Abc_MaxInt(Vec_IntEntry(vIters, i), 0), nClasses );
+        Aig_ManStop( pTemp );
+        ABC_FREE( pMapBack );
+    }
+    Vec_PtrFree( vAigs );
+    Vec_PtrFreeP( &vGias );
+    Vec_PtrFree( vMaps );
+    Vec_IntFree( vCounts );
+    Vec_IntFree( vIters );
+    // remap the AIG
+    pNew = Aig_ManDupRepr( pAig, 0 );
+    Aig_ManSeqCleanup( pNew );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Repeats partitioned sequential SAT sweeping till fix-point.]
+
+  Description [Each round re-partitions the reduced AIG with the register
+  order rotated by half a partition, so that equivalences spanning the
+  boundaries of the previous partitions can be detected. Stops when a
+  round does not reduce registers or nodes. Takes ownership of pAig.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Ssw_SignalCorrespondencePartIterate( Aig_Man_t * pAig, int nPartSize, Ssw_Pars_t * pPars, int fUseGia, int fVerbose )
+{
+    Aig_Man_t * pNew;
+    Vec_Ptr_t * vResult;
+    Vec_Int_t * vDomain;
+    int i, nRegs, iRound, fImproved = 1;
+    for ( iRound = 1; fImproved && Aig_ManRegNum(pAig) > 0; iRound++ )
+    {
+        // rotate the register order
+        nRegs   = Aig_ManRegNum(pAig);
+        vDomain = Vec_IntAlloc( nRegs );
+        for ( i = 0; i < nRegs; i++ )
+            Vec_IntPush( vDomain, (i + iRound * Abc_MaxInt(nPartSize/2, 1)) % nRegs );
+        vResult = Vec_PtrAlloc( 100 );
+        if ( nRegs > nPartSize )
+            Aig_ManPartDivide( vResult, vDomain, nPartSize, pPars->nOverSize );
+        else
+            Vec_PtrPush( vResult, Vec_IntDup(vDomain) );
+        Vec_IntFree( vDomain );
+        pNew = Ssw_SignalCorrespondencePartRound( pAig, vResult, pPars, fUseGia, 0 );
+        fImproved = Aig_ManRegNum(pNew) < Aig_ManRegNum(pAig) || Aig_ManNodeNum(pNew) < Aig_ManNodeNum(pAig);
+        if ( fVerbose )
+            Abc_Print( 1, "Round %3d : Parts = %4d. Reg = %6d -> %6d. And = %7d -> %7d.\n", iRound, Vec_PtrSize(vResult),
+                Aig_ManRegNum(pAig), Aig_ManRegNum(pNew), Aig_ManNodeNum(pAig), Aig_ManNodeNum(pNew) );
+        Vec_VecFree( (Vec_Vec_t *)vResult );
+        Aig_ManStop( pAig );
+        pAig = pNew;
+    }
+    return pAig;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the registers.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Ssw_ManPartitionRegs( Aig_Man_t * pAig, int nPartSize, int nOverSize )
+{
+    Vec_Ptr_t * vResult;
+    Vec_Int_t * vPart;
+    int i;
+    if ( pAig->vClockDoms )
+    {
+        // divide large clock domains into separate partitions
+        vResult = Vec_PtrAlloc( 100 );
+        Vec_PtrForEachEntry( Vec_Int_t *, (Vec_Ptr_t *)pAig->vClockDoms, vPart, i )
+        {
+            if ( nPartSize && Vec_IntSize(vPart) > nPartSize )
+                Aig_ManPartDivide( vResult, vPart, nPartSize, nOverSize );
+            else
+                Vec_PtrPush( vResult, Vec_IntDup(vPart) );
+        }
+    }
+    else
+        vResult = Aig_ManRegPartitionSimple( pAig, nPartSize, nOverSize );
+//    vResult = Aig_ManPartitionSmartRegisters( pAig, nPartSize, 0 ); 
+//    vResult = Aig_ManRegPartitionSmart( pAig, nPartSize );
+    return vResult;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs partitioned sequential SAT sweeping.]
@@ -218,9 +572,8 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
     Aig_Man_t * pTemp, * pNew;
     Vec_Ptr_t * vResult;
     Vec_Int_t * vPart;
-    int * pMapBack;
     int i, nCountPis, nCountRegs;
-    int nClasses, nPartSize, fVerbose;
+    int nPartSize, fVerbose;
     abctime clk = Abc_Clock();
     if ( pPars->fConstrs )
     {
@@ -231,22 +584,7 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
     nPartSize = pPars->nPartSize; pPars->nPartSize = 0;
     fVerbose  = pPars->fVerbose;  pPars->fVerbose  = 0;
     // generate partitions
-    if ( pAig->vClockDoms )
-    {
-        // divide large clock domains into separate partitions
-        vResult = Vec_PtrAlloc( 100 );
-        Vec_PtrForEachEntry( Vec_Int_t *, (Vec_Ptr_t *)pAig->vClockDoms, vPart, i )
-        {
-            if ( nPartSize && Vec_IntSize(vPart) > nPartSize )
-                Aig_ManPartDivide( vResult, vPart, nPartSize, pPars->nOverSize );
-            else
-                Vec_PtrPush( vResult, Vec_IntDup(vPart) );
-        }
-    }
-    else
-        vResult = Aig_ManRegPartitionSimple( pAig, nPartSize, pPars->nOverSize );
-//    vResult = Aig_ManPartitionSmartRegisters( pAig, nPartSize, 0 ); 
-//    vResult = Aig_ManRegPartitionSmart( pAig, nPartSize );
+    vResult = Ssw_ManPartitionRegs( pAig, nPartSize, pPars->nOverSize );
     if ( fPrintParts )
     {
         // print partitions
@@ -262,34 +600,16 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
             Aig_ManStop( pTemp );
         }
     }
-
+    if ( fVerbose && pPars->nProcs > 1 )
+        Abc_Print( 1, "Running concurrent scorr with %d processes.\n", pPars->nProcs );
     // perform SSW with partitions
-    Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
-    Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
-    {
-        pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack );
-        Aig_ManSetRegNum( pTemp, pTemp->nRegs );
-        // create the projection of 1-hot registers
-        if ( pAig->vOnehots )
-            pTemp->vOnehots = Aig_ManRegProjectOnehots( pAig, pTemp, pAig->vOnehots, fVerbose );
-        // run SSW
-        if (nCountPis>0) {
-            pNew = Ssw_SignalCorrespondence( pTemp, pPars );
-            nClasses = Aig_TransferMappedClasses( pAig, pTemp, pMapBack );
-            if ( fVerbose )
-                Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
-                    i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp), pPars->nIters, nClasses );
-            Aig_ManStop( pNew );
-        }
-        Aig_ManStop( pTemp );
-        ABC_FREE( pMapBack );
-    }
-    // remap the AIG
-    pNew = Aig_ManDupRepr( pAig, 0 );
-    Aig_ManSeqCleanup( pNew );
+    pNew = Ssw_SignalCorrespondencePartRound( pAig, vResult, pPars, 0, fVerbose );
+    Vec_VecFree( (Vec_Vec_t *)vResult );
+    // repeat on the reduced AIG to merge equivalences across partitions
+    if ( pPars->fPartIterate && nPartSize > 0 && pAig->vClockDoms == NULL )
+        pNew = Ssw_SignalCorrespondencePartIterate( pNew, nPartSize, pPars, 0, fVerbose );
 //    Aig_ManPrintStats( pAig );
 //    Aig_ManPrintStats( pNew );
-    Vec_VecFree( (Vec_Vec_t *)vResult );
     pPars->nPartSize = nPartSize;
     pPars->fVerbose = fVerbose;
     if ( fVerbose )
@@ -314,16 +634,11 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 {
     int fPrintParts = 1;
-    //char Buffer[100];
     Aig_Man_t * pTemp, * pNew;
-    Vec_Ptr_t * vAigs;    
-    Vec_Ptr_t * vGias;
-    Vec_Ptr_t * vMaps;
     Vec_Ptr_t * vResult;
     Vec_Int_t * vPart;
-    int * pMapBack = NULL;
     int i, nCountPis, nCountRegs;
-    int nClasses, nPartSize, fVerbose;
+    int nPartSize, fVerbose;
     abctime clk = Abc_Clock();
     if ( pPars->fConstrs )
     {
@@ -334,72 +649,26 @@ Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars
     nPartSize = pPars->nPartSize; pPars->nPartSize = 0;
     fVerbose  = pPars->fVerbose;  pPars->fVerbose  = 0;
     // generate partitions
-    if ( pAig->vClockDoms )
-    {
-        // divide large clock domains into separate partitions
-        vResult = Vec_PtrAlloc( 100 );
-        Vec_PtrForEachEntry( Vec_Int_t *, (Vec_Ptr_t *)pAig->vClockDoms, vPart, i )
-        {
-            if ( nPartSize && Vec_IntSize(vPart) > nPartSize )
-                Aig_ManPartDivide( vResult, vPart, nPartSize, pPars->nOverSize );
-            else
-                Vec_PtrPush( vResult, Vec_IntDup(vPart) );
-        }
-    }
-    else
-        vResult = Aig_ManRegPartitionSimple( pAig, nPartSize, pPars->nOverSize );
-//    vResult = Aig_ManPartitionSmartRegisters( pAig, nPartSize, 0 ); 
-//    vResult = Aig_ManRegPartitionSmart( pAig, nPartSize );
-    // collect partitions
-    vAigs = Vec_PtrAlloc( 100 );
-    vGias = Vec_PtrAlloc( 100 );
-    vMaps = Vec_PtrAlloc( 100 );
+    vResult = Ssw_ManPartitionRegs( pAig, nPartSize, pPars->nOverSize );
     if ( fPrintParts )
-        Abc_Print( 1, "Simple partitioning. %d partitions are saved:\n", Vec_PtrSize(vResult) );
-    Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
     {
-        pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack );
-        Aig_ManSetRegNum( pTemp, pTemp->nRegs );
-        Vec_PtrPush( vAigs, pTemp );
-        Vec_PtrPush( vGias, Gia_ManFromAigSimple(pTemp) );
-        Vec_PtrPush( vMaps, pMapBack );
-        //sprintf( Buffer, "part%03d.aig", i );
-        //Ioa_WriteAiger( pTemp, Buffer, 0, 0 );
-        if ( fPrintParts )
+        Abc_Print( 1, "Simple partitioning. %d partitions are saved:\n", Vec_PtrSize(vResult) );
+        Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
+        {
+            pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, NULL );
             Abc_Print( 1, "part%03d.aig : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d.\n",
                 i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp) );
+            Aig_ManStop( pTemp );
+        }
     }
     // solve partitions
-    Ssw_SignalCorrespondenceArray( vGias, pPars );
-    // collect the results
-    Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
-    Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
-    {
-        int * pMapBack = (int *)Vec_PtrEntry( vMaps, i );
-        Gia_Man_t * pGia = (Gia_Man_t *)Vec_PtrEntry( vGias, i );
-        Aig_Man_t * pTemp2 = Gia_ManToAigSimple( pGia );
-        pTemp = (Aig_Man_t *)Vec_PtrEntry( vAigs, i );
-        Gia_ManReprToAigRepr2( pTemp2, pGia );
-        // remap back
-        nClasses = Aig_TransferMappedClasses( pAig, pTemp2, pMapBack );
-        if ( fVerbose )
-            Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
-                i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), 0, 0, Aig_ManNodeNum(pTemp), 0, nClasses );
-        Aig_ManStop( pTemp );
-        Aig_ManStop( pTemp2 );
-        Gia_ManStop( pGia );
-        ABC_FREE( pMapBack );
-    }
-    Vec_PtrFree( vAigs );
-    Vec_PtrFree( vGias );
-    Vec_PtrFree( vMaps );
-
-    // remap the AIG
-    pNew = Aig_ManDupRepr( pAig, 0 );
-    Aig_ManSeqCleanup( pNew );
+    pNew = Ssw_SignalCorrespondencePartRound( pAig, vResult, pPars, 1, fVerbose );
+    Vec_VecFree( (Vec_Vec_t *)vResult );
+    // repeat on the reduced AIG to merge equivalences across partitions
+    if ( pPars->fPartIterate && nPartSize > 0 && pAig->vClockDoms == NULL )
+        pNew = Ssw_SignalCorrespondencePartIterate( pNew, nPartSize, pPars, 1, fVerbose );
 //    Aig_ManPrintStats( pAig );
 //    Aig_ManPrintStats( pNew );
-    Vec_VecFree( (Vec_Vec_t *)vResult );
     pPars->nPartSize = nPartSize;
     pPars->fVerbose = fVerbose;
     if ( fVerbose )
@@ -427,6 +696,8 @@ Gia_Man_t * Gia_SignalCorrespondencePart( Gia_Man_t * p, Cec_ParCor_t * pPars )
     pSswPars->nBTLimit  = pPars->nBTLimit;
     pSswPars->nProcs    = pPars->nProcs;
     pSswPars->nPartSize = pPars->nPartSize;
+    pSswPars->nPartMemLimit = pPars->nPartMemLimit;
+    pSswPars->fPartIterate  = pPars->fPartIterate;
     pSswPars->fVerbose  = pPars->fVerbose;
     pNew = Ssw_SignalCorrespondencePart2( pAig, pSswPars );
     Gia_ManRestoreNodeMapping( pAig, p );
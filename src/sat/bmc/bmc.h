@@ -114,6 +114,7 @@ struct Saig_ParBmc_t_
     int         nFfToAddMax;    // max number of flops to add during CBA
     int         fSkipRand;      // skip random decisions
     int         fNoRestarts;    // disables periodic restarts
+    int         fInprocess;     // enables inprocessing in the SAT solver
     int         fUseSatoko;     // enables using Satoko
     int         fUseGlucose;    // enables using Glucose 3.0
     int         nLearnedStart;  // starting learned clause limit
@@ -143,12 +144,14 @@ struct Bmc_AndPar_t_
     int         nTimeOut;       // timeout in seconds
     int         nLutSize;       // LUT size for cut computation
     int         nProcs;         // the number of parallel solvers
+    int         nOutGroup;      // the number of outputs per job (0 = all outputs together)
     int         fLoadCnf;       // dynamic CNF loading
     int         fDumpFrames;    // dump unrolled timeframes
     int         fUseSynth;      // use synthesis
     int         fUseOldCnf;     // use old CNF construction
     int         fUseGlucose;    // use Glucose 3.0 as the default solver
     int         fUseEliminate;  // use variable elimination
+    int         fSolveAll;      // continue after the first failed output
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
@@ -1489,6 +1489,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         p->pSat->nLearntRatio = p->pPars->nLearnedPerce;
         p->pSat->nLearntMax   = p->pSat->nLearntStart;
         p->pSat->fNoRestarts  = p->pPars->fNoRestarts;
+        if ( p->pPars->fInprocess )
+            sat_solver_set_inprocess( p->pSat, SAT_INPROC_LEARNT | SAT_INPROC_ELIM );
         p->pSat->RunId        = p->pPars->RunId;
         p->pSat->pFuncStop    = p->pPars->pFuncStop;
     }
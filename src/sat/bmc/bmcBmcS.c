@@ -911,6 +911,396 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 #endif // pthreads are used
 
 
+/**Function*************************************************************
+
+  Synopsis    [Unfolds the first nFrames timeframes without deriving CNF.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmcs_ManUnfoldFrames( Bmcs_Man_t * p, int nFrames )
+{
+    Gia_Obj_t * pObj;
+    int f, i, iLitFrame, * pCopies;
+    for ( f = Vec_PtrSize(&p->vGia2Fr); f < nFrames; f++ )
+    {
+        Vec_PtrPush( &p->vGia2Fr, ABC_FALLOC(int, Gia_ManObjNum(p->pGia)) );
+        pCopies = Bmcs_ManCopies( p, f );
+        pCopies[0] = 0;
+        Gia_ManForEachPo( p->pGia, pObj, i )
+        {
+            iLitFrame = Bmcs_ManUnfold_rec( p, Gia_ObjFaninId0p(p->pGia, pObj), f );
+            iLitFrame = Abc_LitNotCond( iLitFrame, Gia_ObjFaninC0(pObj) );
+            pCopies[Gia_ObjId(p->pGia, pObj)] = Gia_ManAppendCo( p->pFrames, iLitFrame );
+        }
+    }
+    assert( Gia_ManPoNum(p->pFrames) == nFrames * Gia_ManPoNum(p->pGia) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Per-output BMC with a work-stealing thread pool.]
+
+  Description [The timeframes are unfolded once, before the threads 
+  start, and the resulting AIG is shared read-only. A job is a group 
+  of consecutive outputs with its own incremental solver, into which 
+  the cones of these outputs are loaded frame by frame. A thread works 
+  on a job for nFramesAdd frames and returns it to the front of its 
+  deque in the work-stealing pool (Util_StealStart), so that all jobs 
+  advance at a similar pace, while idle threads steal jobs from the 
+  other deques or sleep till a job is returned. Counter-examples are reported as 
+  soon as they are found and the failed outputs are dropped from their 
+  jobs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+int Bmcs_ManPerformOutputs( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs_ManPerformOne(pGia, pPars); }
+
+#else // pthreads are used
+
+typedef struct Bmcs_OutJob_t_ Bmcs_OutJob_t;
+struct Bmcs_OutJob_t_
+{
+    int               iOutBeg;                // the first output of the group
+    int               iOutEnd;                // the last output of the group plus one
+    int               iFrame;                 // the next timeframe to check
+    int               fUndec;                 // the solver gave up on some output
+    bmc_sat_solver *  pSat;                   // the incremental solver of this job
+    Vec_Int_t         vSat2Fr;                // maps SAT variables into objects of pFrames
+};
+typedef struct Bmcs_OutMan_t_ Bmcs_OutMan_t;
+struct Bmcs_OutMan_t_
+{
+    Bmcs_Man_t *      p;                      // the unfolding (read-only during solving)
+    Bmc_AndPar_t *    pPars;                  // parameters
+    int               nProcs;                 // the number of threads
+    Vec_Ptr_t *       vJobs;                  // all jobs
+    Util_Steal_t *    pPool;                  // jobs in the deques or being solved
+    pthread_mutex_t   Mutex;                  // protects the shared data below
+    Vec_Ptr_t *       vCexes;                 // counter-examples (one per output)
+    Abc_Cex_t *       pCexFirst;              // the first counter-example found
+    int               nSolved;                // the number of processed job slices
+    abctime           clkStart;               // starting time
+};
+typedef struct Bmcs_OutThData_t_
+{
+    Bmcs_OutMan_t *   pMan;
+    int *             pMap;                   // maps objects of pFrames into SAT variables
+    int               iThread;
+} Bmcs_OutThData_t;
+
+static inline void Bmcs_OutLock( pthread_mutex_t * pMutex )   { int status = pthread_mutex_lock(pMutex);   assert( status == 0 ); }
+static inline void Bmcs_OutUnlock( pthread_mutex_t * pMutex ) { int status = pthread_mutex_unlock(pMutex); assert( status == 0 ); }
+
+int Bmcs_OutLoad_rec( Bmcs_Man_t * p, Bmcs_OutJob_t * pJob, int * pMap, int iObj )
+{
+    Gia_Obj_t * pObj;
+    int iVar, iVar0 = -1, iVar1 = -1, Lits[3];
+    if ( pMap[iObj] >= 0 )
+        return pMap[iObj];
+    pObj = Gia_ManObj( p->pFrames, iObj );
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        iVar0 = Bmcs_OutLoad_rec( p, pJob, pMap, Gia_ObjFaninId0(pObj, iObj) );
+        iVar1 = Bmcs_OutLoad_rec( p, pJob, pMap, Gia_ObjFaninId1(pObj, iObj) );
+    }
+    else assert( Gia_ObjIsCi(pObj) );
+    iVar = bmc_sat_solver_addvar( pJob->pSat );
+    assert( iVar == Vec_IntSize(&pJob->vSat2Fr) );
+    Vec_IntPush( &pJob->vSat2Fr, iObj );
+    pMap[iObj] = iVar;
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        // the solver sorts the literals in place
+        Lits[0] = Abc_Var2Lit( iVar, 1 );
+        Lits[1] = Abc_Var2Lit( iVar0, Gia_ObjFaninC0(pObj) );
+        bmc_sat_solver_addclause( pJob->pSat, Lits, 2 );
+        Lits[0] = Abc_Var2Lit( iVar, 1 );
+        Lits[1] = Abc_Var2Lit( iVar1, Gia_ObjFaninC1(pObj) );
+        bmc_sat_solver_addclause( pJob->pSat, Lits, 2 );
+        Lits[0] = Abc_Var2Lit( iVar, 0 );
+        Lits[1] = Abc_Var2Lit( iVar0, !Gia_ObjFaninC0(pObj) );
+        Lits[2] = Abc_Var2Lit( iVar1, !Gia_ObjFaninC1(pObj) );
+        bmc_sat_solver_addclause( pJob->pSat, Lits, 3 );
+    }
+    return iVar;
+}
+Abc_Cex_t * Bmcs_OutGenerateCex( Bmcs_Man_t * p, Bmcs_OutJob_t * pJob, int i, int f )
+{
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), Gia_ManPoNum(p->pGia), f*Gia_ManPoNum(p->pGia)+i );
+    Gia_Obj_t * pObj;  int iObj, iSatVar;
+    Vec_IntForEachEntry( &pJob->vSat2Fr, iObj, iSatVar )
+    {
+        pObj = Gia_ManObj( p->pFrames, iObj );
+        if ( Gia_ObjIsCi(pObj) && bmc_sat_solver_read_cex_varvalue(pJob->pSat, iSatVar) ) // 1 bit
+        {
+            int iCiId   = Vec_IntEntry( &p->vCiMap, 2*Gia_ObjCioId(pObj)+0 );
+            int iFrame  = Vec_IntEntry( &p->vCiMap, 2*Gia_ObjCioId(pObj)+1 );
+            Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p->pGia) + iFrame * Gia_ManPiNum(p->pGia) + iCiId );
+        }
+    }
+    return pCex;
+}
+void Bmcs_OutSolveJob( Bmcs_OutThData_t * pThData, Bmcs_OutJob_t * pJob )
+{
+    Bmcs_OutMan_t * pMan = pThData->pMan;
+    Bmcs_Man_t * p = pMan->p;
+    Bmc_AndPar_t * pPars = pMan->pPars;
+    int nPos = Gia_ManPoNum(p->pGia);
+    int i, k, f, iObj, iLit, status, nFramesStop;
+    if ( pJob->pSat == NULL )
+    {
+        iLit = Abc_Var2Lit( 0, 1 );
+        pJob->pSat = bmc_sat_solver_start( 0 );
+        bmc_sat_solver_addvar( pJob->pSat );
+        bmc_sat_solver_addclause( pJob->pSat, &iLit, 1 );
+        bmc_sat_solver_setstop( pJob->pSat, &p->fStopNow );
+        if ( pPars->nTimeOut )
+            satoko_set_runtime_limit( pJob->pSat, pMan->clkStart + pPars->nTimeOut * CLOCKS_PER_SEC );
+        Vec_IntPush( &pJob->vSat2Fr, 0 );
+    }
+    // restore the mapping of the already loaded objects
+    Vec_IntForEachEntry( &pJob->vSat2Fr, iObj, k )
+        pThData->pMap[iObj] = k;
+    nFramesStop = Abc_MinInt( pJob->iFrame + pPars->nFramesAdd, pPars->nFramesMax );
+    for ( f = pJob->iFrame; f < nFramesStop && !p->fStopNow; f++ )
+    {
+        for ( i = pJob->iOutBeg; i < pJob->iOutEnd; i++ )
+        {
+            Gia_Obj_t * pObj = Gia_ManCo( p->pFrames, f * nPos + i );
+            if ( Vec_PtrEntry(pMan->vCexes, i) ) // already failed
+                continue;
+            if ( Gia_ObjFaninLit0p(p->pFrames, pObj) == 0 ) // const0 in this frame
+                status = l_False;
+            else 
+            {
+                if ( pPars->nTimeOut && (Abc_Clock() - pMan->clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
+                {
+                    p->fStopNow = 1;
+                    break;
+                }
+                iLit = Bmcs_OutLoad_rec( p, pJob, pThData->pMap, Gia_ObjFaninId0p(p->pFrames, pObj) );
+                iLit = Abc_Var2Lit( iLit, Gia_ObjFaninC0(pObj) );
+                status = satoko_solve_assumptions_limit( pJob->pSat, &iLit, 1, pPars->nConfLimit );
+            }
+            if ( status == l_False ) // unsat
+            {
+                if ( pPars->pFuncOnFrameDone )
+                {
+                    Bmcs_OutLock( &pMan->Mutex );
+                    pPars->pFuncOnFrameDone(f, i, 0);
+                    Bmcs_OutUnlock( &pMan->Mutex );
+                }
+                continue;
+            }
+            if ( status == l_True ) // sat
+            {
+                Abc_Cex_t * pCex = Bmcs_OutGenerateCex( p, pJob, i, f );
+                Bmcs_OutLock( &pMan->Mutex );
+                Vec_PtrWriteEntry( pMan->vCexes, i, pCex );
+                if ( pMan->pCexFirst == NULL )
+                    pMan->pCexFirst = pCex;
+                pPars->nFailOuts++;
+                if ( !pPars->fNotVerbose )
+                {
+                    int nOutDigits = Abc_Base10Log( nPos );
+                    Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).  ",  
+                        nOutDigits, i, f, nOutDigits, pPars->nFailOuts, nOutDigits, nPos );
+                    if ( pPars->fSolveAll )
+                        Abc_PrintTime( 1, "Time", Abc_Clock() - pMan->clkStart );
+                    fflush( stdout );
+                }
+                if( pPars->pFuncOnFrameDone )
+                    pPars->pFuncOnFrameDone(f, i, 1);
+                if ( !pPars->fSolveAll || pPars->nFailOuts == nPos )
+                    p->fStopNow = 1;
+                Bmcs_OutUnlock( &pMan->Mutex );
+                continue;
+            }
+            // the solver gave up on this output
+            pJob->fUndec = 1;
+            break;
+        }
+        if ( i < pJob->iOutEnd )
+            break;
+    }
+    pJob->iFrame = f;
+    // clean the mapping
+    Vec_IntForEachEntry( &pJob->vSat2Fr, iObj, k )
+        pThData->pMap[iObj] = -1;
+}
+int Bmcs_OutJobIsDone( Bmcs_OutMan_t * p, Bmcs_OutJob_t * pJob )
+{
+    int i;
+    if ( pJob->fUndec || pJob->iFrame == p->pPars->nFramesMax )
+        return 1;
+    for ( i = pJob->iOutBeg; i < pJob->iOutEnd; i++ )
+        if ( Vec_PtrEntry(p->vCexes, i) == NULL )
+            return 0;
+    return 1;
+}
+void * Bmcs_OutWorkerThread( void * pArg )
+{
+    Bmcs_OutThData_t * pThData = (Bmcs_OutThData_t *)pArg;
+    Bmcs_OutMan_t * p = pThData->pMan;
+    Bmcs_OutJob_t * pJob;
+    while ( (pJob = (Bmcs_OutJob_t *)Util_StealFetch( p->pPool, pThData->iThread )) != NULL )
+    {
+        Bmcs_OutSolveJob( pThData, pJob );
+        Bmcs_OutLock( &p->Mutex );
+        p->nSolved++;
+        Bmcs_OutUnlock( &p->Mutex );
+        if ( p->p->fStopNow )
+        {
+            // wake up the idle threads to let them terminate
+            Util_StealSetStop( p->pPool );
+            Util_StealFinish( p->pPool );
+        }
+        else if ( Bmcs_OutJobIsDone(p, pJob) )
+        {
+            // release the solver as soon as the job is finished
+            bmc_sat_solver_stop( pJob->pSat );
+            pJob->pSat = NULL;
+            Util_StealFinish( p->pPool );
+        }
+        else // return the job to the front of the deque to let other jobs advance
+            Util_StealReturn( p->pPool, pThData->iThread, pJob );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+int Bmcs_ManPerformOutputs( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    Bmcs_OutMan_t Man, * pMan = &Man;
+    Bmcs_OutThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Bmc_AndPar_t ParsUnf = *pPars;
+    Bmcs_OutJob_t * pJob;
+    int i, status, nJobs, nSteals, nFrames, RetValue = -1;
+    abctime clk;
+    assert( pPars->nOutGroup > 0 );
+    assert( pPars->nProcs >= 1 && pPars->nProcs < PAR_THR_MAX );
+    Abc_CexFreeP( &pGia->pCexSeq );
+    if ( pGia->vSeqModelVec )
+        Vec_PtrFreeFree( pGia->vSeqModelVec ), pGia->vSeqModelVec = NULL;
+    if ( pPars->nFramesMax == 0 )
+    {
+        printf( "The per-output mode requires a limit on the number of timeframes.\n" );
+        return -1;
+    }
+    memset( pMan, 0, sizeof(Bmcs_OutMan_t) );
+    pMan->pPars    = pPars;
+    pMan->nProcs   = pPars->nProcs;
+    pMan->clkStart = Abc_Clock();
+    // unfold the timeframes (the unfolding does not need solvers of its own)
+    ParsUnf.nProcs = 0;
+    pMan->p = Bmcs_ManStart( pGia, &ParsUnf );
+    clk = Abc_Clock();
+    Bmcs_ManUnfoldFrames( pMan->p, pPars->nFramesMax );
+    pMan->p->timeUnf += Abc_Clock() - clk;
+    if ( pPars->fVerbose )
+    {
+        printf( "Unfolded %d frames into %d objects.  ", pPars->nFramesMax, Gia_ManObjNum(pMan->p->pFrames) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - pMan->clkStart );
+    }
+    // create jobs and distribute them among the threads
+    pMan->vCexes = Vec_PtrStart( Gia_ManPoNum(pGia) );
+    pMan->vJobs  = Vec_PtrAlloc( Gia_ManPoNum(pGia) / pPars->nOutGroup + 1 );
+    for ( i = 0; i < Gia_ManPoNum(pGia); i += pPars->nOutGroup )
+    {
+        pJob = ABC_CALLOC( Bmcs_OutJob_t, 1 );
+        pJob->iOutBeg = i;
+        pJob->iOutEnd = Abc_MinInt( i + pPars->nOutGroup, Gia_ManPoNum(pGia) );
+        Vec_PtrPush( pMan->vJobs, pJob );
+    }
+    nJobs = Vec_PtrSize( pMan->vJobs );
+    pMan->pPool = Util_StealStart( pMan->nProcs );
+    status = pthread_mutex_init( &pMan->Mutex, NULL );  assert( status == 0 );
+    Vec_PtrForEachEntry( Bmcs_OutJob_t *, pMan->vJobs, pJob, i )
+        Util_StealAdd( pMan->pPool, i % pMan->nProcs, pJob );
+    // start the threads and wait till they finish
+    clk = Abc_Clock();
+    for ( i = 0; i < pMan->nProcs; i++ )
+    {
+        ThData[i].pMan    = pMan;
+        ThData[i].pMap    = ABC_FALLOC( int, Gia_ManObjNum(pMan->p->pFrames) );
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Bmcs_OutWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < pMan->nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        ABC_FREE( ThData[i].pMap );
+    }
+    pMan->p->timeSat += Abc_Clock() - clk;
+    // the number of frames explored for all outputs that did not fail
+    nFrames = pPars->nFramesMax;
+    Vec_PtrForEachEntry( Bmcs_OutJob_t *, pMan->vJobs, pJob, i )
+    {
+        int k;
+        for ( k = pJob->iOutBeg; k < pJob->iOutEnd; k++ )
+            if ( Vec_PtrEntry(pMan->vCexes, k) == NULL )
+                break;
+        if ( k < pJob->iOutEnd )
+            nFrames = Abc_MinInt( nFrames, pJob->iFrame );
+        if ( pJob->pSat )
+            bmc_sat_solver_stop( pJob->pSat );
+        Vec_IntErase( &pJob->vSat2Fr );
+        ABC_FREE( pJob );
+    }
+    Vec_PtrFree( pMan->vJobs );
+    nSteals = Util_StealStealNum( pMan->pPool );
+    Util_StealStop( pMan->pPool, NULL );
+    pthread_mutex_destroy( &pMan->Mutex );
+    // report the results
+    if ( pMan->pCexFirst )
+    {
+        RetValue = 0;
+        pPars->iFrame = pMan->pCexFirst->iFrame;
+        if ( pPars->fSolveAll )
+            pGia->vSeqModelVec = pMan->vCexes;
+        else
+        {
+            pGia->pCexSeq = pMan->pCexFirst;
+            Vec_PtrWriteEntry( pMan->vCexes, pMan->pCexFirst->iPo, NULL );
+            Vec_PtrFreeFree( pMan->vCexes );
+        }
+    }
+    else
+    {
+        pPars->iFrame = nFrames - 1;
+        Vec_PtrFree( pMan->vCexes );
+    }
+    if ( !pPars->fNotVerbose )
+    {
+        if ( RetValue == -1 )
+            printf( "No output failed in %d frames.  ", nFrames );
+        else if ( pPars->fSolveAll )
+            printf( "Failed %d out of %d outputs. Other outputs did not fail in %d frames.  ", pPars->nFailOuts, Gia_ManPoNum(pGia), nFrames );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - pMan->clkStart );
+    }
+    if ( pPars->fVerbose )
+        printf( "Processed %d jobs of up to %d outputs in %d slices using %d threads (%d steals).\n", 
+            nJobs, pPars->nOutGroup, pMan->nSolved, pMan->nProcs, nSteals );
+    pMan->p->timeOth = Abc_Clock() - pMan->clkStart - pMan->p->timeUnf - pMan->p->timeSat;
+    Bmcs_ManPrintTime( pMan->p );
+    Bmcs_ManStop( pMan->p );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -925,6 +1315,8 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 int Bmcs_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) 
 { 
     assert( pPars->nProcs < PAR_THR_MAX );
+    if ( pPars->nOutGroup > 0 )
+        return Bmcs_ManPerformOutputs( pGia, pPars );
     if ( pPars->nProcs == 1 )
         return Bmcs_ManPerformOne( pGia, pPars );
     else
@@ -1159,6 +1159,8 @@ sat_solver* sat_solver_new(void)
     veci_new(&s->unit_lits);
     veci_new(&s->temp_clause);
     veci_new(&s->conf_final);
+    veci_new(&s->elim_heads);
+    veci_new(&s->elim_clauses);
 
     // initialize arrays
     s->wlists    = 0;
@@ -1224,6 +1226,8 @@ sat_solver* zsat_solver_new_seed(double seed)
     veci_new(&s->unit_lits);
     veci_new(&s->temp_clause);
     veci_new(&s->conf_final);
+    veci_new(&s->elim_heads);
+    veci_new(&s->elim_clauses);
 
     // initialize arrays
     s->wlists    = 0;
@@ -1295,6 +1299,8 @@ void sat_solver_setnvars(sat_solver* s,int n)
         s->reasons   = ABC_REALLOC(int,    s->reasons,  s->cap);
         s->trail     = ABC_REALLOC(lit,    s->trail,    s->cap);
         s->model     = ABC_REALLOC(int,    s->model,    s->cap);
+        s->frozen    = ABC_REALLOC(char,   s->frozen,   s->cap);
+        s->elimed    = ABC_REALLOC(char,   s->elimed,   s->cap);
         memset( s->wlists + 2*old_cap, 0, 2*(s->cap-old_cap)*sizeof(veci) );
     } 
 
@@ -1326,6 +1332,8 @@ void sat_solver_setnvars(sat_solver* s,int n)
         s->orderpos[var] = veci_size(&s->order);
         s->reasons [var] = 0;
         s->model   [var] = 0; 
+        s->frozen  [var] = 0;
+        s->elimed  [var] = 0;
         
         /* does not hold because variables enqueued at top level will not be reinserted in the heap
            assert(veci_size(&s->order) == var); 
@@ -1355,6 +1363,8 @@ void sat_solver_delete(sat_solver* s)
     veci_delete(&s->pivot_vars);
     veci_delete(&s->temp_clause);
     veci_delete(&s->conf_final);
+    veci_delete(&s->elim_heads);
+    veci_delete(&s->elim_clauses);
 
     veci_delete(&s->user_vars);
     veci_delete(&s->user_values);
@@ -1379,6 +1389,8 @@ void sat_solver_delete(sat_solver* s)
         ABC_FREE(s->reasons  );
         ABC_FREE(s->trail    );
         ABC_FREE(s->model    );
+        ABC_FREE(s->frozen   );
+        ABC_FREE(s->elimed   );
     }
 
     sat_solver_store_free(s);
@@ -1399,6 +1411,12 @@ void sat_solver_restart( sat_solver* s )
         s->wlists[i].size = 0;
 
     s->nDBreduces = 0;
+    s->nInprocRounds = 0;
+    s->nInprocNext   = 0;
+    s->nInprocProps  = 0;
+    s->fSolved       = 0;
+    veci_resize(&s->elim_heads, 0);
+    veci_resize(&s->elim_clauses, 0);
 
     // initialize other vars
     s->size                   = 0;
@@ -1445,6 +1463,12 @@ void zsat_solver_restart_seed( sat_solver* s, double seed )
         s->wlists[i].size = 0;
 
     s->nDBreduces = 0;
+    s->nInprocRounds = 0;
+    s->nInprocNext   = 0;
+    s->nInprocProps  = 0;
+    s->fSolved       = 0;
+    veci_resize(&s->elim_heads, 0);
+    veci_resize(&s->elim_clauses, 0);
 
     // initialize other vars
     s->size                   = 0;
@@ -1519,6 +1543,71 @@ int sat_solver_simplify(sat_solver* s)
     return true;
 }
 
+// removes the learned clauses marked for deletion and updates the handles
+static void sat_solver_compact_learned( sat_solver* s )
+{
+    Sat_Mem_t * pMem = &s->Mem;
+    int * act_clas = veci_begin(&s->act_clas);
+    int * pArray;
+    int i, k, j, Counter;
+    clause * c;
+
+    // compact the activities of the remaining clauses
+    j = 0;
+    Sat_MemForEachLearned( pMem, c, i, k )
+        if ( !c->mark )
+            act_clas[j++] = act_clas[clause_id(c)];
+    assert( s->stats.learnts == (unsigned)j );
+    veci_resize(&s->act_clas,j);
+
+    // update ID of each clause to be its new handle
+    Counter = Sat_MemCompactLearned( pMem, 0 );
+    assert( Counter == (int)s->stats.learnts );
+
+    // update reasons
+    for ( i = 0; i < s->size; i++ )
+    {
+        if ( !s->reasons[i] ) // no reason
+            continue;
+        if ( clause_is_lit(s->reasons[i]) ) // 2-lit clause
+            continue;
+        if ( !clause_learnt_h(pMem, s->reasons[i]) ) // problem clause
+            continue;
+        c = clause_read( s, s->reasons[i] );
+        if ( c->mark ) // removed by inprocessing while being a top-level reason
+        {
+            assert( var_level(s, i) == 0 );
+            s->reasons[i] = 0;
+            continue;
+        }
+        s->reasons[i] = clause_id(c); // updating handle here!!!
+    }
+
+    // update watches
+    for ( i = 0; i < s->size*2; i++ )
+    {
+        pArray = veci_begin(&s->wlists[i]);
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        {
+            if ( clause_is_lit(pArray[k]) ) // 2-lit clause
+                pArray[j++] = pArray[k];
+            else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+                pArray[j++] = pArray[k];
+            else 
+            {
+                c = clause_read(s, pArray[k]);
+                if ( !c->mark ) // useful learned clause
+                   pArray[j++] = clause_id(c); // updating handle here!!!
+            }
+        }
+        veci_resize(&s->wlists[i],j);
+    }
+
+    // perform final move of the clauses
+    Counter = Sat_MemCompactLearned( pMem, 1 );
+    assert( Counter == (int)s->stats.learnts );
+}
+
 void sat_solver_reducedb(sat_solver* s)
 {
     static abctime TimeTotal = 0;
@@ -1526,7 +1615,7 @@ void sat_solver_reducedb(sat_solver* s)
     Sat_Mem_t * pMem = &s->Mem;
     int nLearnedOld = veci_size(&s->act_clas);
     int * act_clas = veci_begin(&s->act_clas);
-    int * pPerm, * pArray, * pSortValues, nCutoffValue;
+    int * pPerm, * pSortValues, nCutoffValue;
     int i, k, j, Id, Counter, CounterStart, nSelected;
     clause * c;
 
@@ -1572,7 +1661,7 @@ void sat_solver_reducedb(sat_solver* s)
     {
         assert( c->mark == 0 );
         if ( Counter++ > CounterStart || clause_size(c) < 3 || pSortValues[clause_id(c)] > nCutoffValue || s->reasons[lit_var(c->lits[0])] == Sat_MemHand(pMem, i, k) )
-            act_clas[j++] = act_clas[clause_id(c)];
+            j++;
         else // delete
         {
             c->mark = 1;
@@ -1582,61 +1671,620 @@ void sat_solver_reducedb(sat_solver* s)
     }
     assert( s->stats.learnts == (unsigned)j );
     assert( Counter == nLearnedOld );
-    veci_resize(&s->act_clas,j);
     ABC_FREE( pSortValues );
 
-    // update ID of each clause to be its new handle
-    Counter = Sat_MemCompactLearned( pMem, 0 );
-    assert( Counter == (int)s->stats.learnts );
+    // remove the marked clauses
+    sat_solver_compact_learned( s );
 
-    // update reasons
-    for ( i = 0; i < s->size; i++ )
+    // report the results
+    TimeTotal += Abc_Clock() - clk;
+    if ( s->fVerbose )
     {
-        if ( !s->reasons[i] ) // no reason
+    Abc_Print(1, "reduceDB: Keeping %7d out of %7d clauses (%5.2f %%)  ",
+        s->stats.learnts, nLearnedOld, 100.0 * s->stats.learnts / nLearnedOld );
+    Abc_PrintTime( 1, "Time", TimeTotal );
+    }
+}
+
+//=================================================================================================
+// Inprocessing:
+//
+// Inprocessing runs at decision level 0, either between restarts or, when assumptions are used,
+// at the beginning of 'sat_solver_solve()'. Learned clauses satisfied at the top level are removed,
+// the remaining ones are subsumed and strengthened by other clauses, and vivified by propagating
+// the negation of their literals. Bounded variable elimination replaces the problem clauses
+// of a variable by their resolvents, if this does not increase the number of clauses.
+// Frozen variables (including all assumption variables) are never eliminated. An eliminated
+// variable is restored when a later clause or assumption refers to it, so incremental use
+// remains correct, and its value is reconstructed when a satisfying assignment is found.
+
+#define SAT_INPROC_CONF_START     2000  // conflicts before the first round
+#define SAT_INPROC_CONF_DELTA      500  // increment of the interval between rounds
+#define SAT_INPROC_VIVIFY_LBD        8  // the largest LBD of a clause to be vivified
+#define SAT_INPROC_VIVIFY_PROPS 100000  // the smallest propagation budget of vivification
+#define SAT_INPROC_SUBSUME_WORK 10000000 // the limit on literals visited by subsumption
+#define SAT_INPROC_ELIM_OCC         16  // the largest number of occurrences of an eliminated variable
+#define SAT_INPROC_ELIM_SIZE        24  // the largest size of a resolvent
+#define SAT_INPROC_ELIM_WORK  10000000  // the limit on literals visited by elimination
+
+static inline int  sat_solver_lit_true ( sat_solver* s, lit l ) { return var_value(s, lit_var(l)) ==  lit_sign(l); }
+static inline int  sat_solver_lit_false( sat_solver* s, lit l ) { return var_value(s, lit_var(l)) == !lit_sign(l); }
+static inline int  sat_solver_locked   ( sat_solver* s, clause* c, cla h ) { return s->reasons[lit_var(c->lits[0])] == h; }
+
+static inline void sat_solver_remove_learned( sat_solver* s, clause* c )
+{
+    assert( c->lrn && !c->mark );
+    c->mark = 1;
+    s->stats.learnts--;
+    s->stats.learnts_literals -= clause_size(c);
+}
+
+// adds a clause at the top level; the literals may be changed in place; returns 0 upon conflict
+static int sat_solver_add_top( sat_solver* s, lit* pLits, int nLits, int learnt )
+{
+    int i, j;
+    assert( sat_solver_dl(s) == 0 );
+    for ( i = j = 0; i < nLits; i++ )
+    {
+        if ( sat_solver_lit_true(s, pLits[i]) )
+            return 1;
+        if ( !sat_solver_lit_false(s, pLits[i]) )
+            pLits[j++] = pLits[i];
+    }
+    if ( j == 0 )
+        return 0;
+    if ( j == 1 )
+        return sat_solver_enqueue(s, pLits[0], 0) && sat_solver_propagate(s) == 0;
+    sat_solver_clause_new( s, pLits, pLits + j, learnt );
+    return 1;
+}
+
+// restores the problem clauses of an eliminated variable; returns 0 upon conflict
+static int sat_solver_restore_var( sat_solver* s, int v )
+{
+    int * pHeads = veci_begin(&s->elim_heads);
+    int i, j, k, n, iEnd, RetValue = 1;
+    assert( s->elimed[v] );
+    s->elimed[v] = 0;
+    s->frozen[v] = 1;
+    s->nInprocRestored++;
+    for ( i = veci_size(&s->elim_heads) - 2; i >= 0; i -= 2 )
+        if ( pHeads[i] == v )
+            break;
+    assert( i >= 0 );
+    pHeads[i] = -1;
+    iEnd = (i + 2 < veci_size(&s->elim_heads)) ? pHeads[i+3] : veci_size(&s->elim_clauses);
+    for ( k = pHeads[i+1]; k < iEnd; k += n + 1 )
+    {
+        lit * pLits = veci_begin(&s->elim_clauses) + k + 1;
+        n = veci_begin(&s->elim_clauses)[k];
+        // variables eliminated later may appear in the clause
+        for ( j = 0; j < n; j++ )
+            if ( s->elimed[lit_var(pLits[j])] )
+                RetValue &= sat_solver_restore_var( s, lit_var(pLits[j]) );
+        RetValue &= sat_solver_add_top( s, pLits, n, 0 );
+    }
+    return RetValue;
+}
+
+// assigns the eliminated variables in the model, in the reverse order of elimination
+static void sat_solver_extend_model( sat_solver* s )
+{
+    int * pHeads = veci_begin(&s->elim_heads);
+    int i, j, k, n, iEnd, Value;
+    for ( i = veci_size(&s->elim_heads) - 2; i >= 0; i -= 2 )
+    {
+        if ( pHeads[i] == -1 )
             continue;
-        if ( clause_is_lit(s->reasons[i]) ) // 2-lit clause
+        // the variable is 1 only if it is needed to satisfy a clause where it is positive
+        Value = l_False;
+        iEnd = (i + 2 < veci_size(&s->elim_heads)) ? pHeads[i+3] : veci_size(&s->elim_clauses);
+        for ( k = pHeads[i+1]; k < iEnd && Value == l_False; k += n + 1 )
+        {
+            lit * pLits = veci_begin(&s->elim_clauses) + k + 1;
+            n = veci_begin(&s->elim_clauses)[k];
+            assert( lit_var(pLits[0]) == pHeads[i] );
+            if ( lit_sign(pLits[0]) )
+                continue;
+            for ( j = 1; j < n; j++ )
+                if ( (s->model[lit_var(pLits[j])] == l_True) != lit_sign(pLits[j]) )
+                    break;
+            if ( j == n )
+                Value = l_True;
+        }
+        s->model[pHeads[i]] = Value;
+    }
+}
+
+// vivifies learned clauses by propagating the negation of their literals
+static int sat_solver_vivify_learned( sat_solver* s, ABC_INT64_T nPropLimit )
+{
+    Sat_Mem_t * pMem = &s->Mem;
+    veci cands, lits;
+    clause * c;
+    int i, k, n, h, nKept, Lbd, RetValue = 1;
+    veci_new(&cands);
+    veci_new(&lits);
+    Sat_MemForEachLearned( pMem, c, i, k )
+        if ( !c->mark && clause_size(c) > 2 && (int)c->lbd <= SAT_INPROC_VIVIFY_LBD )
+            veci_push( &cands, Sat_MemHand(pMem, i, k) );
+    // start with the most recent clauses
+    for ( n = veci_size(&cands) - 1; n >= 0 && s->stats.propagations < nPropLimit; n-- )
+    {
+        h = veci_begin(&cands)[n];
+        c = clause_read( s, h );
+        if ( c->mark || sat_solver_locked(s, c, h) )
             continue;
-        if ( !clause_learnt_h(pMem, s->reasons[i]) ) // problem clause
+        veci_resize( &lits, 0 );
+        for ( k = 0; k < clause_size(c); k++ )
+            if ( !sat_solver_lit_false(s, c->lits[k]) )
+                veci_push( &lits, c->lits[k] );
+        // literals implied to be false are dropped; the clause is cut at a conflict or a true literal
+        for ( k = nKept = 0; k < veci_size(&lits); k++ )
+        {
+            lit l = veci_begin(&lits)[k];
+            if ( sat_solver_lit_false(s, l) )
+                continue;
+            veci_begin(&lits)[nKept++] = l;
+            if ( sat_solver_lit_true(s, l) )
+                break;
+            sat_solver_decision( s, lit_neg(l) );
+            if ( sat_solver_propagate(s) )
+                break;
+        }
+        sat_solver_canceluntil( s, 0 );
+        if ( nKept == clause_size(c) )
             continue;
-        c = clause_read( s, s->reasons[i] );
-        assert( c->mark == 0 );
-        s->reasons[i] = clause_id(c); // updating handle here!!!
+        Lbd = c->lbd;
+        sat_solver_remove_learned( s, c );
+        s->nInprocVivified++;
+        if ( nKept == 1 )
+        {
+            if ( !sat_solver_add_top(s, veci_begin(&lits), 1, 1) )
+            {
+                RetValue = 0;
+                break;
+            }
+            continue;
+        }
+        h = sat_solver_clause_new( s, veci_begin(&lits), veci_begin(&lits) + nKept, 1 );
+        clause_read(s, h)->lbd = Abc_MinInt( Lbd, nKept );
     }
+    veci_delete(&cands);
+    veci_delete(&lits);
+    return RetValue;
+}
 
-    // update watches
-    for ( i = 0; i < s->size*2; i++ )
+// occurrence lists of the learned clauses used for subsumption
+typedef struct sat_occ_t_ sat_occ_t;
+struct sat_occ_t_
+{
+    int         nHands;       // the number of learned clauses
+    int *       pHands;       // their handles
+    unsigned *  pSigns;       // their variable signatures
+    int *       pBegs;        // the beginning of the occurrence list of each literal
+    int *       pOccs;        // the indexes of clauses in the occurrence lists
+    char *      pSeen;        // literal marks
+    ABC_INT64_T nWork;        // the number of literals visited
+};
+
+// removes or strengthens the learned clauses subsumed by the given clause
+static int sat_solver_subsume_clause( sat_solver* s, sat_occ_t * p, lit* pLits, int nLits, int iSelf )
+{
+    veci * vTemp = &s->temp_clause;
+    clause * c;
+    unsigned uSign = 0;
+    int i, k, q, n, nSame, nNeg, iBest = 0, LitNeg = 0, RetValue = 1;
+    for ( i = 0; i < nLits; i++ )
     {
-        pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        uSign |= 1u << (lit_var(pLits[i]) & 31);
+        p->pSeen[pLits[i]] = 1;
+        if ( p->pBegs[pLits[i]+1] - p->pBegs[pLits[i]] + p->pBegs[lit_neg(pLits[i])+1] - p->pBegs[lit_neg(pLits[i])] <
+             p->pBegs[pLits[iBest]+1] - p->pBegs[pLits[iBest]] + p->pBegs[lit_neg(pLits[iBest])+1] - p->pBegs[lit_neg(pLits[iBest])] )
+            iBest = i;
+    }
+    // the candidates contain either the best literal or its negation
+    for ( q = 0; q < 2 && RetValue; q++ )
+    {
+        lit Lit = q ? lit_neg(pLits[iBest]) : pLits[iBest];
+        for ( k = p->pBegs[Lit]; k < p->pBegs[Lit+1]; k++ )
         {
-            if ( clause_is_lit(pArray[k]) ) // 2-lit clause
-                pArray[j++] = pArray[k];
-            else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
-                pArray[j++] = pArray[k];
-            else 
+            n = p->pOccs[k];
+            if ( n == iSelf || (uSign & ~p->pSigns[n]) )
+                continue;
+            c = clause_read( s, p->pHands[n] );
+            if ( c->mark || clause_size(c) < nLits || sat_solver_locked(s, c, p->pHands[n]) )
+                continue;
+            p->nWork += clause_size(c);
+            nSame = nNeg = 0;
+            for ( i = 0; i < clause_size(c); i++ )
+                if ( p->pSeen[c->lits[i]] )
+                    nSame++;
+                else if ( p->pSeen[lit_neg(c->lits[i])] )
+                    nNeg++, LitNeg = c->lits[i];
+            if ( nSame == nLits )
             {
-                c = clause_read(s, pArray[k]);
-                if ( !c->mark ) // useful learned clause
-                   pArray[j++] = clause_id(c); // updating handle here!!!
+                sat_solver_remove_learned( s, c );
+                s->nInprocSubsumed++;
+            }
+            else if ( nSame == nLits - 1 && nNeg == 1 )
+            {
+                veci_resize( vTemp, 0 );
+                for ( i = 0; i < clause_size(c); i++ )
+                    if ( c->lits[i] != LitNeg )
+                        veci_push( vTemp, c->lits[i] );
+                sat_solver_remove_learned( s, c );
+                s->nInprocStrengthened++;
+                if ( !sat_solver_add_top(s, veci_begin(vTemp), veci_size(vTemp), 1) )
+                {
+                    RetValue = 0;
+                    break;
+                }
             }
         }
-        veci_resize(&s->wlists[i],j);
     }
+    for ( i = 0; i < nLits; i++ )
+        p->pSeen[pLits[i]] = 0;
+    return RetValue;
+}
 
-    // perform final move of the clauses
-    Counter = Sat_MemCompactLearned( pMem, 1 );
-    assert( Counter == (int)s->stats.learnts );
+// removes satisfied learned clauses, then subsumes and strengthens learned clauses by all clauses
+static int sat_solver_subsume_learned( sat_solver* s, ABC_INT64_T nWorkLimit )
+{
+    Sat_Mem_t * pMem = &s->Mem;
+    sat_occ_t Occ, * p = &Occ;
+    clause * c;
+    int i, k, n, RetValue = 1;
+    memset( p, 0, sizeof(sat_occ_t) );
+    // collect the learned clauses that may be removed
+    p->pHands = ABC_ALLOC( int, s->stats.learnts + 1 );
+    Sat_MemForEachLearned( pMem, c, i, k )
+    {
+        cla h = Sat_MemHand(pMem, i, k);
+        if ( c->mark || clause_size(c) < 3 || sat_solver_locked(s, c, h) )
+            continue;
+        for ( n = 0; n < clause_size(c); n++ )
+            if ( sat_solver_lit_true(s, c->lits[n]) )
+                break;
+        if ( n < clause_size(c) )
+            sat_solver_remove_learned( s, c );
+        else
+            p->pHands[p->nHands++] = h;
+    }
+    // create the occurrence lists
+    p->pSigns = ABC_CALLOC( unsigned, p->nHands + 1 );
+    p->pBegs  = ABC_CALLOC( int, 2 * s->size + 1 );
+    p->pSeen  = ABC_CALLOC( char, 2 * s->size );
+    for ( n = 0; n < p->nHands; n++ )
+    {
+        c = clause_read( s, p->pHands[n] );
+        for ( i = 0; i < clause_size(c); i++ )
+        {
+            p->pSigns[n] |= 1u << (lit_var(c->lits[i]) & 31);
+            p->pBegs[c->lits[i]+1]++;
+        }
+    }
+    for ( i = 0; i < 2 * s->size; i++ )
+        p->pBegs[i+1] += p->pBegs[i];
+    p->pOccs = ABC_ALLOC( int, p->pBegs[2 * s->size] + 1 );
+    for ( n = 0; n < p->nHands; n++ )
+    {
+        c = clause_read( s, p->pHands[n] );
+        for ( i = 0; i < clause_size(c); i++ )
+            p->pOccs[p->pBegs[c->lits[i]]++] = n;
+    }
+    for ( i = 2 * s->size; i > 0; i-- )
+        p->pBegs[i] = p->pBegs[i-1];
+    p->pBegs[0] = 0;
+    // binary clauses (problem and learned) are stored in the watch lists
+    for ( i = 0; i < 2 * s->size && RetValue && p->nWork < nWorkLimit; i++ )
+    {
+        // the watch list may be reallocated when a strengthened clause is added
+        for ( k = 0; k < veci_size(&s->wlists[i]) && RetValue; k++ )
+        {
+            cla h = veci_begin(&s->wlists[i])[k];
+            lit Lits[2];
+            if ( !clause_is_lit(h) )
+                continue;
+            Lits[0] = lit_neg(i);
+            Lits[1] = clause_read_lit(h);
+            if ( Lits[0] < Lits[1] )
+                RetValue = sat_solver_subsume_clause( s, p, Lits, 2, -1 );
+        }
+    }
+    // problem clauses
+    Sat_MemForEachClause( pMem, c, i, k )
+    {
+        if ( !RetValue || p->nWork >= nWorkLimit )
+            break;
+        if ( !c->mark )
+            RetValue = sat_solver_subsume_clause( s, p, c->lits, clause_size(c), -1 );
+    }
+    // learned clauses
+    for ( n = 0; n < p->nHands && RetValue && p->nWork < nWorkLimit; n++ )
+    {
+        c = clause_read( s, p->pHands[n] );
+        if ( !c->mark )
+            RetValue = sat_solver_subsume_clause( s, p, c->lits, clause_size(c), n );
+    }
+    ABC_FREE( p->pHands );
+    ABC_FREE( p->pSigns );
+    ABC_FREE( p->pBegs );
+    ABC_FREE( p->pOccs );
+    ABC_FREE( p->pSeen );
+    return RetValue;
+}
 
-    // report the results
-    TimeTotal += Abc_Clock() - clk;
+// removes a problem clause recorded at the given offset
+static void sat_solver_elim_remove( sat_solver* s, int * pCla )
+{
+    int i, k, * pArray;
+    s->stats.clauses--;
+    s->stats.clauses_literals -= pCla[1];
+    if ( pCla[0] > 0 ) // stored clause
+    {
+        clause * c = clause_read( s, pCla[0] );
+        veci_remove( &s->wlists[lit_neg(c->lits[0])], pCla[0] );
+        veci_remove( &s->wlists[lit_neg(c->lits[1])], pCla[0] );
+        c->mark = 1;
+    }
+    else // 2-lit clause (all copies are removed)
+    {
+        for ( i = 0; i < 2; i++ )
+        {
+            veci * ws = &s->wlists[lit_neg(pCla[2+i])];
+            pArray = veci_begin(ws);
+            for ( k = 0; k < veci_size(ws); k++ )
+                if ( pArray[k] == clause_from_lit(pCla[3-i]) )
+                    pArray[k--] = pArray[--ws->size];
+        }
+    }
+    pCla[0] = -1;
+}
+
+// bounded variable elimination of the variables that are not frozen
+static int sat_solver_elim_vars( sat_solver* s, ABC_INT64_T nWorkLimit )
+{
+    Sat_Mem_t * pMem = &s->Mem;
+    veci cls, res, cands;
+    clause * c;
+    char * pSeen, * pTouched;
+    int * pBegs, * pOccs, * pCount, * pCosts, * pPerm;
+    int i, k, n, v, RetValue = 1, nCands;
+    ABC_INT64_T nWork = 0;
+    veci_new(&cls);
+    veci_new(&res);
+    veci_new(&cands);
+    // collect the problem clauses as (handle, size, lits...), where handle 0 stands for a 2-lit clause
+    Sat_MemForEachClause( pMem, c, i, k )
+    {
+        if ( c->mark )
+            continue;
+        veci_push( &cls, Sat_MemHand(pMem, i, k) );
+        veci_push( &cls, clause_size(c) );
+        for ( n = 0; n < clause_size(c); n++ )
+            veci_push( &cls, c->lits[n] );
+    }
+    for ( i = 0; i < 2 * s->size; i++ )
+    {
+        cla * pArray = veci_begin(&s->wlists[i]);
+        for ( k = 0; k < veci_size(&s->wlists[i]); k++ )
+            if ( clause_is_lit(pArray[k]) && lit_neg(i) < clause_read_lit(pArray[k]) )
+            {
+                veci_push( &cls, 0 );
+                veci_push( &cls, 2 );
+                veci_push( &cls, lit_neg(i) );
+                veci_push( &cls, clause_read_lit(pArray[k]) );
+            }
+    }
+    // create the occurrence lists
+    pBegs    = ABC_CALLOC( int, 2 * s->size + 1 );
+    pCount   = ABC_CALLOC( int, 2 * s->size );
+    pSeen    = ABC_CALLOC( char, 2 * s->size );
+    pTouched = ABC_CALLOC( char, s->size );
+    for ( i = 0; i < veci_size(&cls); i += 2 + cls.ptr[i+1] )
+        for ( k = 0; k < cls.ptr[i+1]; k++ )
+            pCount[cls.ptr[i+2+k]]++;
+    for ( i = 0; i < 2 * s->size; i++ )
+        pBegs[i+1] = pBegs[i] + pCount[i];
+    pOccs = ABC_ALLOC( int, pBegs[2 * s->size] + 1 );
+    memset( pCount, 0, sizeof(int) * 2 * s->size );
+    for ( i = 0; i < veci_size(&cls); i += 2 + cls.ptr[i+1] )
+        for ( k = 0; k < cls.ptr[i+1]; k++ )
+        {
+            lit Lit = cls.ptr[i+2+k];
+            pOccs[pBegs[Lit] + pCount[Lit]++] = i;
+        }
+    // order the candidates by the number of resolution steps
+    for ( v = 0; v < s->size; v++ )
+    {
+        int nPos = pCount[toLit(v)], nNeg = pCount[lit_neg(toLit(v))];
+        if ( s->frozen[v] || s->elimed[v] || var_value(s, v) != varX || nPos + nNeg == 0 || nPos + nNeg > SAT_INPROC_ELIM_OCC )
+            continue;
+        veci_push( &cands, v );
+    }
+    nCands = veci_size(&cands);
+    pCosts = ABC_ALLOC( int, nCands + 1 );
+    for ( i = 0; i < nCands; i++ )
+        pCosts[i] = pCount[toLit(cands.ptr[i])] * pCount[lit_neg(toLit(cands.ptr[i]))];
+    pPerm = Abc_MergeSortCost( pCosts, nCands );
+    for ( n = 0; n < nCands && RetValue && nWork < nWorkLimit; n++ )
+    {
+        lit Pos, Neg;
+        int iP, iN, nRes = 0, fFail = 0;
+        v = cands.ptr[pPerm[n]];
+        Pos = toLit(v);
+        Neg = lit_neg(Pos);
+        if ( pTouched[v] || var_value(s, v) != varX )
+            continue;
+        // compute the resolvents
+        veci_resize( &res, 0 );
+        for ( iP = pBegs[Pos]; iP < pBegs[Pos+1] && !fFail; iP++ )
+        {
+            int * pP = veci_begin(&cls) + pOccs[iP];
+            if ( pP[0] == -1 )
+                continue;
+            for ( k = 0; k < pP[1]; k++ )
+                if ( sat_solver_lit_true(s, pP[2+k]) )
+                    break;
+            if ( k < pP[1] )
+                continue;
+            for ( k = 0; k < pP[1]; k++ )
+                pSeen[pP[2+k]] = 1;
+            for ( iN = pBegs[Neg]; iN < pBegs[Neg+1] && !fFail; iN++ )
+            {
+                int * pN = veci_begin(&cls) + pOccs[iN];
+                int iStart = veci_size(&res), fTaut = 0;
+                if ( pN[0] == -1 )
+                    continue;
+                nWork += pP[1] + pN[1];
+                veci_push( &res, 0 );
+                for ( k = 0; k < pP[1]; k++ )
+                    if ( pP[2+k] != Pos && !sat_solver_lit_false(s, pP[2+k]) )
+                        veci_push( &res, pP[2+k] );
+                for ( k = 0; k < pN[1] && !fTaut; k++ )
+                {
+                    lit Lit = pN[2+k];
+                    if ( Lit == Neg || pSeen[Lit] || sat_solver_lit_false(s, Lit) )
+                        continue;
+                    if ( pSeen[lit_neg(Lit)] || sat_solver_lit_true(s, Lit) )
+                        fTaut = 1;
+                    else
+                        veci_push( &res, Lit );
+                }
+                if ( fTaut )
+                {
+                    veci_resize( &res, iStart );
+                    continue;
+                }
+                res.ptr[iStart] = veci_size(&res) - iStart - 1;
+                if ( res.ptr[iStart] > SAT_INPROC_ELIM_SIZE || ++nRes > pCount[Pos] + pCount[Neg] )
+                    fFail = 1;
+            }
+            for ( k = 0; k < pP[1]; k++ )
+                pSeen[pP[2+k]] = 0;
+        }
+        if ( fFail )
+            continue;
+        // save the clauses of the variable, with the pivot literal first, and remove them
+        veci_push( &s->elim_heads, v );
+        veci_push( &s->elim_heads, veci_size(&s->elim_clauses) );
+        for ( iP = pBegs[Pos]; iP < pBegs[Neg+1]; iP++ )
+        {
+            int * pCla, Pivot = iP < pBegs[Pos+1] ? Pos : Neg;
+            if ( cls.ptr[pOccs[iP]] == -1 )
+                continue;
+            veci_push( &s->elim_clauses, cls.ptr[pOccs[iP]+1] );
+            veci_push( &s->elim_clauses, Pivot );
+            pCla = veci_begin(&cls) + pOccs[iP];
+            for ( k = 0; k < pCla[1]; k++ )
+            {
+                if ( pCla[2+k] != Pivot )
+                    veci_push( &s->elim_clauses, pCla[2+k] );
+                pCount[pCla[2+k]]--;
+            }
+            sat_solver_elim_remove( s, pCla );
+        }
+        s->elimed[v] = 1;
+        s->nInprocElimed++;
+        // add the resolvents; their variables cannot be eliminated in this round
+        for ( i = 0; i < veci_size(&res) && RetValue; i += 1 + res.ptr[i] )
+        {
+            for ( k = 0; k < res.ptr[i]; k++ )
+                pTouched[lit_var(res.ptr[i+1+k])] = 1;
+            RetValue = sat_solver_add_top( s, veci_begin(&res) + i + 1, res.ptr[i], 0 );
+        }
+    }
+    // learned clauses with eliminated variables are removed
+    Sat_MemForEachLearned( pMem, c, i, k )
+    {
+        if ( c->mark )
+            continue;
+        for ( n = 0; n < clause_size(c); n++ )
+            if ( s->elimed[lit_var(c->lits[n])] )
+                break;
+        if ( n == clause_size(c) )
+            continue;
+        // 2-lit learned clauses were counted as problem clauses when removed from the watch lists
+        if ( clause_size(c) == 2 )
+            s->stats.clauses++, s->stats.clauses_literals += 2;
+        sat_solver_remove_learned( s, c );
+    }
+    veci_delete(&cls);
+    veci_delete(&res);
+    veci_delete(&cands);
+    ABC_FREE( pBegs );
+    ABC_FREE( pOccs );
+    ABC_FREE( pCount );
+    ABC_FREE( pSeen );
+    ABC_FREE( pTouched );
+    ABC_FREE( pCosts );
+    ABC_FREE( pPerm );
+    return RetValue;
+}
+
+// performs one round of inprocessing at the top level; returns 0 if the problem is UNSAT
+int sat_solver_inprocess( sat_solver* s )
+{
+    abctime clk = Abc_Clock();
+    ABC_INT64_T nPropLimit;
+    char * pPolarity;
+    int nLearntsOld = s->stats.learnts;
+    int nElimedOld  = s->nInprocElimed;
+    int RetValue    = 1;
+    assert( sat_solver_dl(s) == 0 );
+    s->nInprocRounds++;
+    s->nInprocNext = s->stats.conflicts + SAT_INPROC_CONF_START + SAT_INPROC_CONF_DELTA * s->nInprocRounds;
+    if ( s->fSolved )
+        return 0;
+    // clause modifications are not supported while recording clauses for proofs
+    if ( s->pStore )
+        return 1;
+    if ( sat_solver_propagate(s) )
+    {
+        s->fSolved = 1;
+        return 0;
+    }
+    // vivification should not change the saved phases
+    pPolarity = ABC_ALLOC( char, s->size + 1 );
+    memcpy( pPolarity, s->polarity, sizeof(char) * s->size );
+    nPropLimit = (s->stats.propagations - s->nInprocProps) / 10;
+    if ( nPropLimit < SAT_INPROC_VIVIFY_PROPS )
+        nPropLimit = SAT_INPROC_VIVIFY_PROPS;
+    nPropLimit += s->stats.propagations;
+    if ( s->fInprocess & SAT_INPROC_LEARNT )
+    {
+        RetValue = sat_solver_subsume_learned( s, SAT_INPROC_SUBSUME_WORK );
+        if ( RetValue )
+            RetValue = sat_solver_vivify_learned( s, nPropLimit );
+    }
+    // variables cannot be eliminated if the clauses may be rolled back
+    if ( RetValue && (s->fInprocess & SAT_INPROC_ELIM) && s->Mem.BookMarkH[0] == 0 )
+        RetValue = sat_solver_elim_vars( s, SAT_INPROC_ELIM_WORK );
+    sat_solver_compact_learned( s );
+    memcpy( s->polarity, pPolarity, sizeof(char) * s->size );
+    ABC_FREE( pPolarity );
+    s->nInprocProps = s->stats.propagations;
+    if ( !RetValue )
+        s->fSolved = 1;
     if ( s->fVerbose )
     {
-    Abc_Print(1, "reduceDB: Keeping %7d out of %7d clauses (%5.2f %%)  ",
-        s->stats.learnts, nLearnedOld, 100.0 * s->stats.learnts / nLearnedOld );
-    Abc_PrintTime( 1, "Time", TimeTotal );
+        Abc_Print( 1, "inprocess: Learned %7d -> %7d  Viv = %d  Sub = %d  Str = %d  Elim = %d (+%d)  Rest = %d  ",
+            nLearntsOld, s->stats.learnts, s->nInprocVivified, s->nInprocSubsumed, s->nInprocStrengthened,
+            s->nInprocElimed, s->nInprocElimed - nElimedOld, s->nInprocRestored );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     }
+    return RetValue;
 }
 
+void sat_solver_set_frozen( sat_solver* s, int v, int fFrozen )
+{
+    if ( v >= s->size )
+        sat_solver_setnvars( s, v + 1 );
+    if ( fFrozen && s->elimed[v] && !sat_solver_restore_var(s, v) )
+        s->fSolved = 1;
+    s->frozen[v] = (char)(fFrozen != 0);
+}
 
 // reverses to the previously bookmarked point
 void sat_solver_rollback( sat_solver* s )
@@ -1696,10 +2344,16 @@ void sat_solver_rollback( sat_solver* s )
     // resize learned arrays
     veci_resize(&s->act_clas,  s->stats.learnts);
 
+    // top-level conflicts may depend on the removed clauses
+    s->fSolved = 0;
+
     // initialize other vars
     s->size = s->iVarPivot;
     if ( s->size == 0 )
     {
+        veci_resize(&s->elim_heads, 0);
+        veci_resize(&s->elim_clauses, 0);
+
     //    s->size                   = 0;
     //    s->cap                    = 0;
         s->qhead                  = 0;
@@ -1761,6 +2415,12 @@ int sat_solver_addclause(sat_solver* s, lit* begin, lit* end)
     }
     sat_solver_setnvars(s,maxvar+1);
 
+    // restore eliminated variables used in the clause
+    if ( veci_size(&s->elim_heads) )
+        for ( i = begin; i < end; i++ )
+            if ( s->elimed[lit_var(*i)] && !sat_solver_restore_var(s, lit_var(*i)) )
+                return false;
+
     ///////////////////////////////////
     // add clause to internal storage
     if ( s->pStore )
@@ -1971,6 +2631,12 @@ int sat_solver_solve_internal(sat_solver* s)
                 s->progress_estimate*100);
             fflush(stdout);
         }
+        // inprocessing between restarts is only done without assumptions
+        if ( s->fInprocess && s->root_level == 0 && s->stats.conflicts >= s->nInprocNext && !sat_solver_inprocess(s) )
+        {
+            status = l_False;
+            break;
+        }
         nof_conflicts = (ABC_INT64_T)( 100 * luby(2, restart_iter++) );
         status = sat_solver_search(s, nof_conflicts);
         // quit the loop if reached an external limit
@@ -1987,6 +2653,9 @@ int sat_solver_solve_internal(sat_solver* s)
         printf("==============================================================================\n");
 
     sat_solver_canceluntil(s,s->root_level);
+    // assign eliminated variables
+    if ( status == l_True && veci_size(&s->elim_heads) )
+        sat_solver_extend_model(s);
     // save variable values
     if ( status == l_True && s->user_vars.size )
     {
@@ -2086,6 +2755,15 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
 
     sat_solver_set_resource_limits( s, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
 
+    // assumption variables are frozen and restored if eliminated
+    if ( s->fInprocess & SAT_INPROC_ELIM )
+        for ( i = begin; i < end; i++ )
+            sat_solver_set_frozen( s, lit_var(*i), 1 );
+    if ( s->fInprocess && s->stats.conflicts >= s->nInprocNext )
+        sat_solver_inprocess( s );
+    if ( s->fSolved )
+        return l_False;
+
 #ifdef SAT_USE_ANALYZE_FINAL
     // Perform assumptions:
     s->root_level = 0;
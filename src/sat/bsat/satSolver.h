@@ -70,6 +70,12 @@ extern void        sat_solver_setnvars(sat_solver* s,int n);
 extern int         sat_solver_get_var_value(sat_solver* s, int v);
 extern void        sat_solver_set_var_activity(sat_solver* s, int * pVars, int nVars);
 
+// inprocessing
+#define SAT_INPROC_LEARNT  1   // vivification, subsumption and strengthening of learned clauses
+#define SAT_INPROC_ELIM    2   // bounded elimination of variables that are not frozen
+extern int         sat_solver_inprocess(sat_solver* s);
+extern void        sat_solver_set_frozen(sat_solver* s, int v, int fFrozen);
+
 extern void        Sat_SolverWriteDimacs( sat_solver * p, char * pFileName, lit* assumptionsBegin, lit* assumptionsEnd, int incrementVars );
 extern void        Sat_SolverPrintStats( FILE * pFile, sat_solver * p );
 extern int *       Sat_SolverGetModel( sat_solver * p, int * pVars, int nVars );
@@ -206,6 +212,21 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+
+    // inprocessing
+    int         fInprocess;     // inprocessing mode (SAT_INPROC_LEARNT and/or SAT_INPROC_ELIM)
+    int         nInprocRounds;  // the number of inprocessing rounds
+    ABC_INT64_T nInprocNext;    // the number of conflicts triggering the next round
+    ABC_INT64_T nInprocProps;   // the number of propagations after the last round
+    char*       frozen;         // variables that cannot be eliminated
+    char*       elimed;         // variables currently eliminated
+    veci        elim_heads;     // (var, offset) of each eliminated variable (var = -1 if restored)
+    veci        elim_clauses;   // clauses removed with eliminated variables: (size, pivot, lits...)
+    int         nInprocVivified;     // learned clauses shortened by vivification
+    int         nInprocSubsumed;     // learned clauses removed by subsumption
+    int         nInprocStrengthened; // learned clauses shortened by self-subsuming resolution
+    int         nInprocElimed;       // variables eliminated
+    int         nInprocRestored;     // eliminated variables restored
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -317,6 +338,13 @@ static inline abctime sat_solver_set_runtime_limit(sat_solver* s, abctime Limit)
     return nRuntimeLimit;
 }
 
+static inline int sat_solver_set_inprocess(sat_solver* s, int Mode)
+{
+    int ModeOld = s->fInprocess;
+    s->fInprocess = Mode;
+    return ModeOld;
+}
+
 static inline int sat_solver_set_random(sat_solver* s, int fNotUseRandom)
 {
     int fNotUseRandomOld = s->fNotUseRandom;
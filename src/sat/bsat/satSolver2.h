@@ -79,6 +79,8 @@ extern void         Int2_ManStop( Int2_Man_t * p );
 extern int          Int2_ManChainStart( Int2_Man_t * p, clause * c );
 extern int          Int2_ManChainResolve( Int2_Man_t * p, clause * c, int iLit, int varA );
 extern void *       Int2_ManReadInterpolant( sat_solver2 * s );
+extern void *       Int2_ManDupInterpolant( sat_solver2 * s );
+extern int          Int2_ManReadObjNum( sat_solver2 * s );
 
 
 //=================================================================================================
@@ -94,6 +94,38 @@ void * Int2_ManReadInterpolant( sat_solver2 * pSat )
     return (void *)pGia;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns a copy of the interpolant.]
+
+  Description [Unlike Int2_ManReadInterpolant(), keeps the internal AIG,
+  so that the partial interpolants of the learned clauses remain valid 
+  when the solver is called again under different assumptions.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Int2_ManDupInterpolant( sat_solver2 * pSat )
+{
+    Int2_Man_t * p = pSat->pInt2;
+    Gia_Man_t * pGia;
+    Vec_Int_t * vLits;
+    if ( pSat->hProofLast == -1 )
+        return NULL;
+    vLits = Vec_IntAlloc( 1 );
+    Vec_IntPush( vLits, pSat->hProofLast );
+    pGia = Gia_ManDupDfsLitArray( p->pGia, vLits );
+    Vec_IntFree( vLits );
+    pSat->hProofLast = -1;
+    return (void *)pGia;
+}
+int Int2_ManReadObjNum( sat_solver2 * pSat )
+{
+    return pSat->pInt2 ? Gia_ManObjNum(pSat->pInt2->pGia) : 0;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computing interpolant for a clause.]
@@ -76,7 +76,7 @@ void Sat_SolverWriteDimacs( sat_solver * p, char * pFileName, lit* assumpBegin,
     Sat_Mem_t * pMem = &p->Mem;
     FILE * pFile;
     clause * c;
-    int i, k, nUnits;
+    int i, k, nUnits, nRemoved;
 
     // count the number of unit clauses
     nUnits = 0;
@@ -84,6 +84,12 @@ void Sat_SolverWriteDimacs( sat_solver * p, char * pFileName, lit* assumpBegin,
         if ( p->levels[i] == 0 && p->assigns[i] != 3 )
             nUnits++;
 
+    // count the clauses removed by variable elimination
+    nRemoved = 0;
+    Sat_MemForEachClause( pMem, c, i, k )
+        if ( c->mark )
+            nRemoved++;
+
     // start the file
     pFile = pFileName ? fopen( pFileName, "wb" ) : stdout;
     if ( pFile == NULL )
@@ -92,11 +98,12 @@ void Sat_SolverWriteDimacs( sat_solver * p, char * pFileName, lit* assumpBegin,
         return;
     }
 //    fprintf( pFile, "c CNF generated by ABC on %s\n", Extra_TimeStamp() );
-    fprintf( pFile, "p cnf %d %d\n", p->size, Sat_MemEntryNum(&p->Mem, 0)-1+Sat_MemEntryNum(&p->Mem, 1)+nUnits+(int)(assumpEnd-assumpBegin) );
+    fprintf( pFile, "p cnf %d %d\n", p->size, Sat_MemEntryNum(&p->Mem, 0)-1-nRemoved+Sat_MemEntryNum(&p->Mem, 1)+nUnits+(int)(assumpEnd-assumpBegin) );
 
     // write the original clauses
     Sat_MemForEachClause( pMem, c, i, k )
-        Sat_SolverClauseWriteDimacs( pFile, c, incrementVars );
+        if ( !c->mark )
+            Sat_SolverClauseWriteDimacs( pFile, c, incrementVars );
 
     // write the learned clauses
 //    Sat_MemForEachLearned( pMem, c, i, k )
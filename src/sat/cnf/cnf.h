@@ -51,6 +51,7 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Cnf_Man_t_            Cnf_Man_t;
 typedef struct Cnf_Dat_t_            Cnf_Dat_t;
 typedef struct Cnf_Cut_t_            Cnf_Cut_t;
+typedef struct Cnf_IncMan_t_         Cnf_IncMan_t;
 
 // the CNF asserting outputs of AIG to be 1
 struct Cnf_Dat_t_
@@ -148,6 +149,18 @@ extern void            Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot, Vec
                            Vec_Ptr_t * vNodes, Vec_Int_t * vMap, Vec_Int_t * vCover, Vec_Int_t * vClauses );
 extern void            Cnf_DeriveFastMark( Aig_Man_t * p );
 extern Cnf_Dat_t *     Cnf_DeriveFast( Aig_Man_t * p, int nOutputs );
+/*=== cnfInc.c ========================================================*/
+extern Cnf_IncMan_t *  Cnf_IncManStart( Aig_Man_t * pAig );
+extern void            Cnf_IncManStop( Cnf_IncMan_t * p );
+extern void            Cnf_IncManPrintStats( Cnf_IncMan_t * p );
+extern Vec_Int_t *     Cnf_IncManVarMap( Cnf_IncMan_t * p );
+extern int             Cnf_IncManVarNum( Cnf_IncMan_t * p );
+extern Vec_Int_t *     Cnf_IncManClauses( Cnf_IncMan_t * p );
+extern int             Cnf_IncManObjVar( Cnf_IncMan_t * p, Aig_Obj_t * pObj );
+extern int             Cnf_IncManObjLit( Cnf_IncMan_t * p, Aig_Obj_t * pObj );
+extern int             Cnf_IncManUpdate( Cnf_IncMan_t * p );
+extern int             Cnf_IncManFlushToSolver( Cnf_IncMan_t * p, void * pSat );
+extern int             Cnf_IncManBenchmark( Aig_Man_t * pAig, int nFrames, int nConfLimit, int fVerbose );
 /*=== cnfMan.c ========================================================*/
 extern Cnf_Man_t *     Cnf_ManStart();
 extern void            Cnf_ManStop( Cnf_Man_t * p );
@@ -0,0 +1,516 @@
+/**CFile****************************************************************
+
+  FileName    [cnfInc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Incremental CNF derivation for growing AIGs.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: cnfInc.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "aig/saig/saig.h"
+#include "sat/bsat/satSolver.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The incremental CNF manager keeps, for each AIG object, its SAT variable,
+// its mapping cut (up to four leaves with the truth table), and the fanins
+// the object had when its clauses were written. The clauses are derived on
+// demand, only for the cones of the requested objects, using the same
+// minimum SOPs of 4-input functions as Cnf_Derive(). Objects added to the
+// AIG after the previous call get new variables; objects whose fanins have
+// changed are detected by Cnf_IncManUpdate() and re-encoded, together
+// with their transitive fanout, using fresh variables. Variables of the
+// unchanged objects never change, so the map can be used by incremental
+// solvers. Variable 0 is not used.
+
+struct Cnf_IncMan_t_
+{
+    Aig_Man_t *     pAig;            // the AIG (may grow between calls)
+    Cnf_Man_t *     pManCnf;         // the CNF manager with 4-input SOPs
+    int             nVars;           // the number of SAT variables used
+    Vec_Int_t *     vObj2Var;        // SAT variable of each object (-1 if none)
+    Vec_Int_t *     vObj2Cut;        // offset of the object's cut in vCuts (-1 if none)
+    Vec_Int_t *     vFanins;         // fanins of each encoded object (two entries per object)
+    Vec_Int_t *     vCuts;           // cuts as {nLeaves, Leaf0, ..., Truth}
+    Vec_Int_t *     vClauses;        // new clauses as {nLits, Lit0, ...}
+    Vec_Int_t *     vStack;          // traversal stack
+    Vec_Int_t *     vLeaves;         // temporary leaves
+    Vec_Int_t *     vCover;          // temporary cover
+    int             nClausesFlushed; // the number of clauses handed over
+    // statistics
+    int             nObjsEncoded;    // the number of encoded objects
+    int             nClauses;        // the number of derived clauses
+    int             nReencoded;      // the number of re-encoded objects
+};
+
+static inline int   Cnf_IncObjVar( Cnf_IncMan_t * p, int iObj )              { return iObj < Vec_IntSize(p->vObj2Var) ? Vec_IntEntry(p->vObj2Var, iObj) : -1; }
+static inline int   Cnf_IncObjFaninLit( Aig_Obj_t * pObj, int n )            { Aig_Obj_t * pFan = n ? Aig_ObjChild1(pObj) : Aig_ObjChild0(pObj); return pFan ? Abc_Var2Lit(Aig_Regular(pFan)->Id, Aig_IsComplement(pFan)) : -1; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the incremental CNF manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_IncMan_t * Cnf_IncManStart( Aig_Man_t * pAig )
+{
+    Cnf_IncMan_t * p;
+    p = ABC_CALLOC( Cnf_IncMan_t, 1 );
+    Cnf_ManPrepare();
+    p->pAig     = pAig;
+    p->pManCnf  = Cnf_ManRead();
+    p->nVars    = 1;
+    p->vObj2Var = Vec_IntAlloc( Aig_ManObjNumMax(pAig) );
+    p->vObj2Cut = Vec_IntAlloc( Aig_ManObjNumMax(pAig) );
+    p->vFanins  = Vec_IntAlloc( 2 * Aig_ManObjNumMax(pAig) );
+    p->vCuts    = Vec_IntAlloc( 6 * Aig_ManObjNumMax(pAig) );
+    p->vClauses = Vec_IntAlloc( 1 << 16 );
+    p->vStack   = Vec_IntAlloc( 1000 );
+    p->vLeaves  = Vec_IntAlloc( 8 );
+    p->vCover   = Vec_IntAlloc( 1 << 4 );
+    return p;
+}
+void Cnf_IncManStop( Cnf_IncMan_t * p )
+{
+    Vec_IntFree( p->vObj2Var );
+    Vec_IntFree( p->vObj2Cut );
+    Vec_IntFree( p->vFanins );
+    Vec_IntFree( p->vCuts );
+    Vec_IntFree( p->vClauses );
+    Vec_IntFree( p->vStack );
+    Vec_IntFree( p->vLeaves );
+    Vec_IntFree( p->vCover );
+    ABC_FREE( p );
+}
+void Cnf_IncManPrintStats( Cnf_IncMan_t * p )
+{
+    printf( "Incremental CNF:  Objs = %d.  Encoded = %d.  Re-encoded = %d.  Vars = %d.  Clauses = %d.  Cut memory = %.2f MB.\n",
+        Aig_ManObjNumMax(p->pAig), p->nObjsEncoded, p->nReencoded, p->nVars, p->nClauses,
+        4.0 * (Vec_IntCap(p->vCuts) + Vec_IntCap(p->vObj2Var) + Vec_IntCap(p->vObj2Cut) + Vec_IntCap(p->vFanins)) / (1<<20) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the stable object-to-variable map.]
+
+  Description [The map is indexed by object IDs and contains -1 for the
+  objects that are not encoded yet. The map may be reallocated by the
+  next call to the manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cnf_IncManVarMap( Cnf_IncMan_t * p )  { return p->vObj2Var;  }
+int         Cnf_IncManVarNum( Cnf_IncMan_t * p )  { return p->nVars;     }
+Vec_Int_t * Cnf_IncManClauses( Cnf_IncMan_t * p ) { return p->vClauses;  }
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the mapping cut of the node.]
+
+  Description [Starting from the fanins, expands the leaves that are
+  internal nodes without variables and with one fanout, as long as the
+  cut has at most four leaves. Returns the truth table of the node in
+  terms of the leaves.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned Cnf_IncManCutTruth_rec( Cnf_IncMan_t * p, Aig_Obj_t * pObj )
+{
+    static unsigned uTruths[4] = { 0xAAAA, 0xCCCC, 0xF0F0, 0xFF00 };
+    unsigned uTruth0, uTruth1;
+    int k = Vec_IntFind( p->vLeaves, pObj->Id );
+    if ( k >= 0 )
+        return uTruths[k];
+    assert( Aig_ObjIsNode(pObj) );
+    // remember the fanins of the internal nodes to detect changes
+    Vec_IntWriteEntry( p->vFanins, 2*pObj->Id+0, Cnf_IncObjFaninLit(pObj, 0) );
+    Vec_IntWriteEntry( p->vFanins, 2*pObj->Id+1, Cnf_IncObjFaninLit(pObj, 1) );
+    uTruth0 = Cnf_IncManCutTruth_rec( p, Aig_ObjFanin0(pObj) );
+    uTruth1 = Cnf_IncManCutTruth_rec( p, Aig_ObjFanin1(pObj) );
+    uTruth0 = Aig_ObjFaninC0(pObj) ? ~uTruth0 : uTruth0;
+    uTruth1 = Aig_ObjFaninC1(pObj) ? ~uTruth1 : uTruth1;
+    return 0xFFFF & (uTruth0 & uTruth1);
+}
+static inline int Cnf_IncManCanExpand( Cnf_IncMan_t * p, Aig_Obj_t * pLeaf )
+{
+    int nNew;
+    if ( !Aig_ObjIsNode(pLeaf) || Aig_ObjRefs(pLeaf) != 1 || Cnf_IncObjVar(p, pLeaf->Id) >= 0 )
+        return 0;
+    nNew = Vec_IntSize(p->vLeaves) - 1;
+    nNew += (Vec_IntFind(p->vLeaves, Aig_ObjFaninId0(pLeaf)) == -1);
+    nNew += (Vec_IntFind(p->vLeaves, Aig_ObjFaninId1(pLeaf)) == -1) && (Aig_ObjFaninId0(pLeaf) != Aig_ObjFaninId1(pLeaf));
+    return nNew <= 4;
+}
+static void Cnf_IncManDeriveCut( Cnf_IncMan_t * p, Aig_Obj_t * pObj )
+{
+    Aig_Obj_t * pLeaf;
+    unsigned uTruth;
+    int i, iLeaf;
+    assert( Aig_ObjIsNode(pObj) );
+    Vec_IntClear( p->vLeaves );
+    Vec_IntPushUnique( p->vLeaves, Aig_ObjFaninId0(pObj) );
+    Vec_IntPushUnique( p->vLeaves, Aig_ObjFaninId1(pObj) );
+    // greedily absorb single-fanout nodes into the cut
+    for ( i = 0; i < Vec_IntSize(p->vLeaves); i++ )
+    {
+        pLeaf = Aig_ManObj( p->pAig, Vec_IntEntry(p->vLeaves, i) );
+        if ( !Cnf_IncManCanExpand(p, pLeaf) )
+            continue;
+        Vec_IntDrop( p->vLeaves, i );
+        Vec_IntPushUnique( p->vLeaves, Aig_ObjFaninId0(pLeaf) );
+        Vec_IntPushUnique( p->vLeaves, Aig_ObjFaninId1(pLeaf) );
+        i = -1;
+    }
+    assert( Vec_IntSize(p->vLeaves) <= 4 );
+    uTruth = Cnf_IncManCutTruth_rec( p, pObj );
+    // save the cut
+    Vec_IntWriteEntry( p->vObj2Cut, pObj->Id, Vec_IntSize(p->vCuts) );
+    Vec_IntPush( p->vCuts, Vec_IntSize(p->vLeaves) );
+    Vec_IntForEachEntry( p->vLeaves, iLeaf, i )
+        Vec_IntPush( p->vCuts, iLeaf );
+    Vec_IntPush( p->vCuts, (int)uTruth );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of one node.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_IncManWriteClauses( Cnf_IncMan_t * p, int OutVar, int * pCut )
+{
+    extern int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals );
+    int pVars[4], pLits[5], nLeaves = pCut[0];
+    unsigned uTruth = (unsigned)pCut[nLeaves+1];
+    int i, k, Cube, nLits, fCompl;
+    for ( k = 0; k < nLeaves; k++ )
+    {
+        pVars[k] = Vec_IntEntry( p->vObj2Var, pCut[k+1] );
+        assert( pVars[k] > 0 );
+    }
+    for ( fCompl = 0; fCompl < 2; fCompl++ )
+    {
+        unsigned uFunc = 0xFFFF & (fCompl ? ~uTruth : uTruth);
+        Cnf_SopConvertToVector( p->pManCnf->pSops[uFunc], p->pManCnf->pSopSizes[uFunc], p->vCover );
+        Vec_IntForEachEntry( p->vCover, Cube, i )
+        {
+            pLits[0] = Abc_Var2Lit( OutVar, fCompl );
+            nLits = 1 + Cnf_IsopWriteCube( Cube, nLeaves, pVars, pLits + 1 );
+            Vec_IntPush( p->vClauses, nLits );
+            for ( k = 0; k < nLits; k++ )
+                Vec_IntPush( p->vClauses, pLits[k] );
+            p->nClauses++;
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT variable of the object.]
+
+  Description [Encodes the cone of the object, which is not encoded yet.
+  The traversal uses an explicit stack to handle deep AIGs, such as the
+  ones produced by unrolling.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cnf_IncManAssignVar( Cnf_IncMan_t * p, Aig_Obj_t * pObj )
+{
+    int Var = p->nVars++;
+    Vec_IntWriteEntry( p->vObj2Var, pObj->Id, Var );
+    Vec_IntWriteEntry( p->vFanins, 2*pObj->Id+0, Cnf_IncObjFaninLit(pObj, 0) );
+    Vec_IntWriteEntry( p->vFanins, 2*pObj->Id+1, Cnf_IncObjFaninLit(pObj, 1) );
+    p->nObjsEncoded++;
+    return Var;
+}
+int Cnf_IncManObjVar( Cnf_IncMan_t * p, Aig_Obj_t * pObj )
+{
+    Aig_Obj_t * pNode, * pLeaf;
+    int * pCut, k, iNode, fReady, Var;
+    assert( !Aig_IsComplement(pObj) );
+    if ( Aig_ObjIsCo(pObj) )
+        return Cnf_IncManObjVar( p, Aig_ObjFanin0(pObj) );
+    if ( Cnf_IncObjVar(p, pObj->Id) > 0 )
+        return Cnf_IncObjVar(p, pObj->Id);
+    // extend the storage to cover the new objects
+    Vec_IntFillExtra( p->vObj2Var, Aig_ManObjNumMax(p->pAig), -1 );
+    Vec_IntFillExtra( p->vObj2Cut, Aig_ManObjNumMax(p->pAig), -1 );
+    Vec_IntFillExtra( p->vFanins, 2 * Aig_ManObjNumMax(p->pAig), -1 );
+    Vec_IntClear( p->vStack );
+    Vec_IntPush( p->vStack, pObj->Id );
+    while ( Vec_IntSize(p->vStack) > 0 )
+    {
+        iNode = Vec_IntEntryLast( p->vStack );
+        pNode = Aig_ManObj( p->pAig, iNode );
+        if ( Cnf_IncObjVar(p, iNode) > 0 )
+        {
+            Vec_IntPop( p->vStack );
+            continue;
+        }
+        if ( Aig_ObjIsConst1(pNode) )
+        {
+            Var = Cnf_IncManAssignVar( p, pNode );
+            Vec_IntPushTwo( p->vClauses, 1, Abc_Var2Lit(Var, 0) );
+            p->nClauses++;
+            Vec_IntPop( p->vStack );
+            continue;
+        }
+        if ( Aig_ObjIsCi(pNode) )
+        {
+            Cnf_IncManAssignVar( p, pNode );
+            Vec_IntPop( p->vStack );
+            continue;
+        }
+        assert( Aig_ObjIsNode(pNode) );
+        if ( Vec_IntEntry(p->vObj2Cut, iNode) == -1 )
+            Cnf_IncManDeriveCut( p, pNode );
+        // make sure the leaves are encoded
+        pCut = Vec_IntEntryP( p->vCuts, Vec_IntEntry(p->vObj2Cut, iNode) );
+        fReady = 1;
+        for ( k = 1; k <= pCut[0]; k++ )
+        {
+            pLeaf = Aig_ManObj( p->pAig, pCut[k] );
+            if ( Cnf_IncObjVar(p, pLeaf->Id) > 0 )
+                continue;
+            Vec_IntPush( p->vStack, pLeaf->Id );
+            fReady = 0;
+        }
+        if ( !fReady )
+            continue;
+        Var = Cnf_IncManAssignVar( p, pNode );
+        Cnf_IncManWriteClauses( p, Var, pCut );
+        Vec_IntPop( p->vStack );
+    }
+    return Cnf_IncObjVar( p, pObj->Id );
+}
+int Cnf_IncManObjLit( Cnf_IncMan_t * p, Aig_Obj_t * pObj )
+{
+    return Abc_Var2Lit( Cnf_IncManObjVar(p, Aig_Regular(pObj)), Aig_IsComplement(pObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Invalidates the encoding of the changed objects.]
+
+  Description [Compares the current fanins of the encoded objects with
+  those recorded when the clauses were written. The objects whose fanins
+  have changed, and all encoded objects depending on them, lose their
+  variables and cuts. They will be re-encoded with fresh variables when
+  requested next time. The old clauses remain in the solver but constrain
+  only the old variables, which are no longer referenced. Returns the
+  number of invalidated objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncManUpdate( Cnf_IncMan_t * p )
+{
+    Vec_Ptr_t * vNodes;
+    Vec_Int_t * vDirty;
+    Aig_Obj_t * pObj;
+    int i, nChanges = 0, nInvalid = 0;
+    vDirty = Vec_IntStart( Aig_ManObjNumMax(p->pAig) );
+    Aig_ManForEachNode( p->pAig, pObj, i )
+    {
+        if ( 2*i >= Vec_IntSize(p->vFanins) || Vec_IntEntry(p->vFanins, 2*i) == -1 )
+            continue;
+        if ( Vec_IntEntry(p->vFanins, 2*i+0) == Cnf_IncObjFaninLit(pObj, 0) && Vec_IntEntry(p->vFanins, 2*i+1) == Cnf_IncObjFaninLit(pObj, 1) )
+            continue;
+        Vec_IntWriteEntry( vDirty, i, 1 );
+        nChanges++;
+    }
+    if ( nChanges == 0 )
+    {
+        Vec_IntFree( vDirty );
+        return 0;
+    }
+    // propagate the changes to the transitive fanout in a topological order
+    vNodes = Aig_ManDfs( p->pAig, 1 );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        if ( Vec_IntEntry(vDirty, Aig_ObjFaninId0(pObj)) || Vec_IntEntry(vDirty, Aig_ObjFaninId1(pObj)) )
+            Vec_IntWriteEntry( vDirty, pObj->Id, 1 );
+    Vec_PtrFree( vNodes );
+    Vec_IntForEachEntry( vDirty, nChanges, i )
+    {
+        if ( nChanges == 0 || 2*i >= Vec_IntSize(p->vFanins) )
+            continue;
+        if ( Vec_IntEntry(p->vObj2Var, i) > 0 )
+            nInvalid++;
+        Vec_IntWriteEntry( p->vObj2Var, i, -1 );
+        Vec_IntWriteEntry( p->vObj2Cut, i, -1 );
+        Vec_IntWriteEntry( p->vFanins, 2*i+0, -1 );
+        Vec_IntWriteEntry( p->vFanins, 2*i+1, -1 );
+    }
+    Vec_IntFree( vDirty );
+    p->nReencoded += nInvalid;
+    return nInvalid;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the clauses derived since the last call into the solver.]
+
+  Description [Returns 0 if the solver became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncManFlushToSolver( Cnf_IncMan_t * p, void * pSolver )
+{
+    sat_solver * pSat = (sat_solver *)pSolver;
+    int i, nLits, RetValue = 1;
+    if ( sat_solver_nvars(pSat) < p->nVars )
+        sat_solver_setnvars( pSat, p->nVars );
+    for ( i = 0; i < Vec_IntSize(p->vClauses); i += nLits + 1 )
+    {
+        nLits = Vec_IntEntry( p->vClauses, i );
+        if ( !sat_solver_addclause( pSat, Vec_IntArray(p->vClauses) + i + 1, Vec_IntArray(p->vClauses) + i + 1 + nLits ) )
+            RetValue = 0;
+        p->nClausesFlushed++;
+    }
+    Vec_IntClear( p->vClauses );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares incremental and complete CNF derivation on BMC.]
+
+  Description [Unrolls the sequential AIG frame by frame into one growing
+  combinational AIG, as done by BMC engines. After each frame, the new
+  outputs are checked by the incremental solver loaded with clauses
+  produced by the incremental manager, while Cnf_Derive() is called on
+  the complete unrolling for comparison. Returns the first frame where
+  an output is SAT, or -1 if none is found.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncManBenchmark( Aig_Man_t * pAig, int nFrames, int nConfLimit, int fVerbose )
+{
+    Cnf_IncMan_t * p;
+    Cnf_Dat_t * pCnf;
+    Aig_Man_t * pFrames, * pTemp;
+    Aig_Obj_t * pObj, * pObjLi, * pObjLo;
+    sat_solver * pSat;
+    abctime clk, clkInc = 0, clkFull = 0, clkSat = 0, clkTotal = Abc_Clock();
+    int f, i, Lit, status, nClausesFull = 0, iFrameSat = -1;
+    assert( Saig_ManRegNum(pAig) > 0 );
+    pFrames = Aig_ManStart( nFrames * Aig_ManObjNumMax(pAig) );
+    Aig_ManConst1(pAig)->pData = Aig_ManConst1(pFrames);
+    Saig_ManForEachLo( pAig, pObj, i )
+        pObj->pData = Aig_ManConst0(pFrames);
+    p = Cnf_IncManStart( pFrames );
+    pSat = sat_solver_new();
+    for ( f = 0; f < nFrames && iFrameSat == -1; f++ )
+    {
+        // add the next frame
+        Saig_ManForEachPi( pAig, pObj, i )
+            pObj->pData = Aig_ObjCreateCi( pFrames );
+        Aig_ManForEachNode( pAig, pObj, i )
+            pObj->pData = Aig_And( pFrames, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        Saig_ManForEachPo( pAig, pObj, i )
+            pObj->pData = Aig_ObjCreateCo( pFrames, Aig_ObjChild0Copy(pObj) );
+        Saig_ManForEachLi( pAig, pObj, i )
+            pObj->pData = Aig_ObjChild0Copy(pObj);
+        Saig_ManForEachLiLo( pAig, pObjLi, pObjLo, i )
+            pObjLo->pData = pObjLi->pData;
+        // derive CNF incrementally and check the outputs of this frame
+        Saig_ManForEachPo( pAig, pObj, i )
+        {
+            clk = Abc_Clock();
+            Lit = Cnf_IncManObjLit( p, Aig_ObjChild0((Aig_Obj_t *)pObj->pData) );
+            Cnf_IncManFlushToSolver( p, pSat );
+            clkInc += Abc_Clock() - clk;
+            clk = Abc_Clock();
+            status = sat_solver_solve( pSat, &Lit, &Lit + 1, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+            clkSat += Abc_Clock() - clk;
+            if ( status == l_True && iFrameSat == -1 )
+                iFrameSat = f;
+        }
+        // derive CNF for the complete unrolling (on a copy, because Cnf_Derive() 
+        // removes dangling nodes, which include the next-state functions)
+        pTemp = Aig_ManDupSimple( pFrames );
+        clk = Abc_Clock();
+        pCnf = Cnf_Derive( pTemp, Aig_ManCoNum(pTemp) );
+        nClausesFull = pCnf->nClauses;
+        Cnf_DataFree( pCnf );
+        clkFull += Abc_Clock() - clk;
+        Aig_ManStop( pTemp );
+        if ( fVerbose )
+        {
+            printf( "Frame %4d :  AIG = %8d.  Inc vars = %8d.  Inc clauses = %9d.  Full clauses = %9d.  ",
+                f, Aig_ManNodeNum(pFrames), Cnf_IncManVarNum(p), p->nClauses, nClausesFull );
+            printf( "Inc = %7.2f sec   Full = %7.2f sec\n", 1.0*((double)(clkInc))/((double)CLOCKS_PER_SEC), 1.0*((double)(clkFull))/((double)CLOCKS_PER_SEC) );
+        }
+    }
+    if ( fVerbose )
+        Cnf_IncManPrintStats( p );
+    if ( iFrameSat >= 0 )
+        printf( "An output is SAT in frame %d.  ", iFrameSat );
+    else
+        printf( "No output is SAT in %d frames.  ", f );
+    printf( "Speedup of CNF derivation = %.2f.\n", clkInc ? 1.0*clkFull/clkInc : 0.0 );
+    ABC_PRT( "Incremental CNF", clkInc );
+    ABC_PRT( "Complete CNF   ", clkFull );
+    ABC_PRT( "SAT solving    ", clkSat );
+    ABC_PRT( "Total time     ", Abc_Clock() - clkTotal );
+    sat_solver_delete( pSat );
+    Cnf_IncManStop( p );
+    Aig_ManStop( pFrames );
+    return iFrameSat;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
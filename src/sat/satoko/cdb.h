@@ -10,16 +10,26 @@
 #define satoko__cdb_h
 
 #include "clause.h"
+#include "utils/mem.h"
 
 #include "misc/util/abc_global.h"
 ABC_NAMESPACE_HEADER_START
 
-/* Clauses DB data structure */
+/* Clauses DB data structure
+ *
+ * The arena is aligned to cache lines and clauses that fit into one line are
+ * never split across two lines, so that propagation touches a single line
+ * per short clause. The words skipped for alignment are kept in 'padding'
+ * and are not counted as wasted. */
+#define CDB_LINE_WORDS 16
+
 struct cdb {
     unsigned size;
     unsigned cap;
     unsigned wasted;
+    unsigned padding;
     unsigned *data;
+    unsigned *raw;
 };
 
 //===------------------------------------------------------------------------===
@@ -38,6 +48,7 @@ static inline unsigned cdb_cref(struct cdb *p, unsigned *clause)
 static inline void cdb_grow(struct cdb *p, unsigned cap)
 {
     unsigned prev_cap = p->cap;
+    unsigned *raw;
 
     if (p->cap >= cap)
         return;
@@ -47,7 +58,14 @@ static inline void cdb_grow(struct cdb *p, unsigned cap)
         assert(p->cap >= prev_cap);
     }
     assert(p->cap > 0);
-    p->data = satoko_realloc(unsigned, p->data, p->cap);
+    raw = satoko_alloc(unsigned, p->cap + CDB_LINE_WORDS);
+    if (p->raw) {
+        unsigned *data = (unsigned *)(((ABC_PTRUINT_T)raw + 4 * CDB_LINE_WORDS - 1) & ~(ABC_PTRUINT_T)(4 * CDB_LINE_WORDS - 1));
+        memcpy(data, p->data, sizeof(unsigned) * p->size);
+        satoko_free(p->raw);
+    }
+    p->raw = raw;
+    p->data = (unsigned *)(((ABC_PTRUINT_T)raw + 4 * CDB_LINE_WORDS - 1) & ~(ABC_PTRUINT_T)(4 * CDB_LINE_WORDS - 1));
 }
 
 static inline struct cdb *cdb_alloc(unsigned cap)
@@ -61,14 +79,21 @@ static inline struct cdb *cdb_alloc(unsigned cap)
 
 static inline void cdb_free(struct cdb *p)
 {
-    satoko_free(p->data);
+    satoko_free(p->raw);
     satoko_free(p);
 }
 
 static inline unsigned cdb_append(struct cdb *p, unsigned size)
 {
     unsigned prev_size;
+    unsigned offset = p->size % CDB_LINE_WORDS;
     assert(size > 0);
+    /* Start a new cache line if the clause would straddle two of them */
+    if (size <= CDB_LINE_WORDS && offset + size > CDB_LINE_WORDS) {
+        cdb_grow(p, p->size + CDB_LINE_WORDS - offset);
+        p->padding += CDB_LINE_WORDS - offset;
+        p->size += CDB_LINE_WORDS - offset;
+    }
     cdb_grow(p, p->size + size);
     prev_size = p->size;
     p->size += size;
@@ -84,6 +109,7 @@ static inline void cdb_remove(struct cdb *p, struct clause *clause)
 static inline void cdb_clear(struct cdb *p)
 {
     p->wasted = 0;
+    p->padding = 0;
     p->size = 0;
 }
 
@@ -102,5 +128,10 @@ static inline unsigned cdb_wasted(struct cdb *p)
     return p->wasted;
 }
 
+static inline unsigned cdb_padding(struct cdb *p)
+{
+    return p->padding;
+}
+
 ABC_NAMESPACE_HEADER_END
 #endif /* satoko__cdb_h */
@@ -154,4 +154,46 @@ int satoko_parse_dimacs(char *fname, satoko_t **solver)
     return SATOKO_OK;
 }
 
+/** Replay a DIMACS file, such as one dumped by 'satoko_write_dimacs'.
+ *
+ * The file is parsed and solved 'n_runs' times with the given options. Only
+ * the solving time is measured. Prints the status, the conflicts and the
+ * propagation throughput of each run and returns the status of the last one
+ * (or -1 if the file could not be read).
+ */
+int satoko_replay_dimacs(char *fname, satoko_opts_t *opts, int n_runs, int verbose)
+{
+    satoko_t *p;
+    satoko_stats_t *stats;
+    abctime clk, clk_total = 0;
+    long n_props_total = 0;
+    int i, status = -1;
+
+    for (i = 0; i < n_runs; i++) {
+        if (satoko_parse_dimacs(fname, &p) != SATOKO_OK)
+            return -1;
+        satoko_configure(p, opts);
+        clk = Abc_Clock();
+        status = satoko_solve(p);
+        clk = Abc_Clock() - clk;
+        stats = satoko_stats(p);
+        clk_total += clk;
+        n_props_total += stats->n_propagations;
+        if (verbose) {
+            printf("Run %3d : %-13s  Vars = %8d  Clauses = %9d  Conflicts = %9ld  Props = %11ld  ",
+                   i, status == SATOKO_SAT ? "SATISFIABLE" : (status == SATOKO_UNSAT ? "UNSATISFIABLE" : "UNDECIDED"),
+                   satoko_varnum(p), satoko_clausenum(p), stats->n_conflicts, stats->n_propagations);
+            printf("Mprops/sec = %7.2f  Time = %7.2f sec\n",
+                   clk ? 1.0e-6 * stats->n_propagations * CLOCKS_PER_SEC / clk : 0.0, 1.0 * clk / CLOCKS_PER_SEC);
+        }
+        satoko_destroy(p);
+    }
+    printf("%-40s : %-13s  Runs = %3d  Mprops/sec = %7.2f  Time = %7.2f sec (%.2f sec per run)\n", fname,
+           status == SATOKO_SAT ? "SATISFIABLE" : (status == SATOKO_UNSAT ? "UNSATISFIABLE" : "UNDECIDED"), n_runs,
+           clk_total ? 1.0e-6 * n_props_total * CLOCKS_PER_SEC / clk_total : 0.0,
+           1.0 * clk_total / CLOCKS_PER_SEC, 1.0 * clk_total / CLOCKS_PER_SEC / n_runs);
+    fflush(stdout);
+    return status;
+}
+
 ABC_NAMESPACE_IMPL_END
@@ -94,6 +94,7 @@ extern void satoko_reset(satoko_t *);
 extern void satoko_default_opts(satoko_opts_t *);
 extern void satoko_configure(satoko_t *, satoko_opts_t *);
 extern int  satoko_parse_dimacs(char *, satoko_t **);
+extern int  satoko_replay_dimacs(char *, satoko_opts_t *, int, int);
 extern void satoko_setnvars(satoko_t *, int);
 extern int  satoko_add_variable(satoko_t *, char);
 extern int  satoko_add_clause(satoko_t *, int *, int);
@@ -571,6 +571,9 @@ unsigned solver_propagate(solver_t *s)
                 continue;
             }
 
+            /* Bring in the clause of the next watcher while this one is processed */
+            if (i + 1 < end)
+                stk_prefetch(clause_fetch(s, (i + 1)->cref));
             clause = clause_fetch(s, i->cref);
             lits = &(clause->data[0].lit);
 
@@ -586,7 +589,24 @@ unsigned solver_propagate(solver_t *s)
             /* If 0th watch is true, then clause is already satisfied. */
             if (lits[0] != i->blocker && lit_value(s, lits[0]) == SATOKO_LIT_TRUE)
                 *j++ = w;
-            else {
+            else if (clause->size == 3) {
+                /* Ternary clause: the only candidate for the new watch is lits[2] */
+                if (lit_value(s, lits[2]) != SATOKO_LIT_FALSE) {
+                    lits[1] = lits[2];
+                    lits[2] = neg_lit;
+                    watch_list_push(vec_wl_at(s->watches, lit_compl(lits[1])), w, 0);
+                    goto next;
+                }
+                *j++ = w;
+                if (lit_value(s, lits[0]) == SATOKO_LIT_FALSE) {
+                    conf_cref = i->cref;
+                    s->i_qhead = vec_uint_size(s->trail);
+                    i++;
+                    while (i < end)
+                        *j++ = *i++;
+                } else
+                    solver_enqueue(s, lits[0], i->cref);
+            } else {
                 /* Look for new watch */
                 unsigned k;
                 for (k = 2; k < clause->size; k++) {
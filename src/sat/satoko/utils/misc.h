@@ -14,6 +14,12 @@ ABC_NAMESPACE_HEADER_START
 
 #define stk_swap(type, a, b)  { type t = a; a = b; b = t; }
 
+#if defined(__GNUC__) || defined(__clang__)
+#define stk_prefetch(addr)  __builtin_prefetch((addr), 1, 3)
+#else
+#define stk_prefetch(addr)
+#endif
+
 static inline unsigned stk_uint_max(unsigned a, unsigned b)
 {
     return a > b ?  a : b;